@@ -1,42 +1,87 @@
 #include "Components/Animation/SCAnimAsyncAction.h"
 #include "Components/Animation/SCCurveAnimComponent.h"
 
-USCAnimAsyncAction *
-USCAnimAsyncAction::CreateProxy(USCCurveAnimComponent *Component,
-                                USCAnimSequence *Sequence, double Duration,
-                                bool bLoop) {
+USCAnimAsyncAction *USCAnimAsyncAction::CreateProxy(
+    USCCurveAnimComponent *Component, USCAnimSequence *Sequence,
+    TSoftObjectPtr<USCAnimSequence> SoftSequence, double Duration,
+    bool bLoop) {
   if (!Component)
     return nullptr;
   USCAnimAsyncAction *Proxy = NewObject<USCAnimAsyncAction>();
   Proxy->TargetComponent = Component;
   Proxy->TargetSequence = Sequence;
+  Proxy->TargetSoftSequence = SoftSequence;
   Proxy->TargetDuration = static_cast<float>(Duration);
   Proxy->TargetLoop = bLoop;
   Proxy->RegisterWithGameInstance(Component);
   return Proxy;
 }
 
+USCAnimAsyncAction *USCAnimAsyncAction::GetOrCreateProxy(
+    USCAnimAsyncAction *Existing, USCCurveAnimComponent *Component,
+    USCAnimSequence *Sequence, TSoftObjectPtr<USCAnimSequence> SoftSequence,
+    double Duration, bool bLoop, bool &bCreated) {
+  bCreated = !IsValid(Existing);
+  USCAnimAsyncAction *Proxy =
+      bCreated ? NewObject<USCAnimAsyncAction>() : Existing;
+  if (Proxy->TargetComponent != Component) {
+    Proxy->BindToComponent(Component);
+  }
+  Proxy->TargetSequence = Sequence;
+  Proxy->TargetSoftSequence = SoftSequence;
+  Proxy->TargetDuration = static_cast<float>(Duration);
+  Proxy->TargetLoop = bLoop;
+  return Proxy;
+}
+
 void USCAnimAsyncAction::Activate() {
   if (!TargetComponent) {
     Cleanup();
     return;
   }
 
-  TargetComponent->OnAnimationUpdate.AddDynamic(
-      this, &USCAnimAsyncAction::HandleUpdate);
-  TargetComponent->OnAnimationFinished.AddDynamic(
-      this, &USCAnimAsyncAction::HandleFinished);
-  TargetComponent->OnAnimationNotify.AddDynamic(
-      this, &USCAnimAsyncAction::HandleNotify);
+  BindToComponent(TargetComponent);
 
   // Start the animation!
   Play(true);
 }
 
+void USCAnimAsyncAction::RunCommand(ESCAnimProxyCommand Command) {
+  switch (Command) {
+  case ESCAnimProxyCommand::Play:
+  case ESCAnimProxyCommand::PlayFromStart:
+    // Both pins restart playback, as they did when every pin activated its
+    // own proxy.
+    Play(true);
+    break;
+  case ESCAnimProxyCommand::Stop:
+    Stop();
+    break;
+  case ESCAnimProxyCommand::Pause:
+    Pause();
+    break;
+  case ESCAnimProxyCommand::Resume:
+    Resume();
+    break;
+  case ESCAnimProxyCommand::ReverseFromEnd:
+    ReverseFromEnd(true);
+    break;
+  case ESCAnimProxyCommand::ReverseFromCurrent:
+    ReverseFromCurrent();
+    break;
+  }
+}
+
 void USCAnimAsyncAction::Play(bool bFromStart) {
-  if (TargetComponent)
+  if (!TargetComponent)
+    return;
+  if (!TargetSequence && !TargetSoftSequence.IsNull()) {
+    TargetComponent->PlaySoft(TargetSoftSequence, TargetDuration, bFromStart,
+                              false, TargetLoop);
+  } else {
     TargetComponent->PlayEx(TargetSequence, TargetDuration, bFromStart, false,
                             TargetLoop);
+  }
 }
 
 void USCAnimAsyncAction::Stop() {
@@ -58,6 +103,9 @@ void USCAnimAsyncAction::ReverseFromEnd(bool bFromStart) {
   if (TargetComponent && TargetSequence) {
     TargetComponent->PlayEx(TargetSequence, TargetDuration, bFromStart, true,
                             TargetLoop);
+  } else if (TargetComponent && !TargetSoftSequence.IsNull()) {
+    TargetComponent->PlaySoft(TargetSoftSequence, TargetDuration, bFromStart,
+                              true, TargetLoop);
   }
 }
 
@@ -67,8 +115,7 @@ void USCAnimAsyncAction::ReverseFromCurrent() {
 }
 
 void USCAnimAsyncAction::HandleUpdate(float CurrentTime, float NormalizedTime) {
-  if (TargetComponent && TargetComponent->AnimSequence != TargetSequence) {
-    Cleanup();
+  if (!IsTrackingComponent()) {
     return;
   }
 
@@ -77,17 +124,17 @@ void USCAnimAsyncAction::HandleUpdate(float CurrentTime, float NormalizedTime) {
 }
 
 void USCAnimAsyncAction::HandleFinished() {
+  if (!IsTrackingComponent()) {
+    return;
+  }
+
   float FinalTime =
       TargetComponent ? TargetComponent->GetPlaybackPosition() : 0.0f;
   Finished.Broadcast(NAME_None, static_cast<double>(FinalTime), 1.0);
-
-  // Clean up bindings to prevent duplicate events on next run
-  Cleanup();
 }
 
 void USCAnimAsyncAction::HandleNotify(FName NotifyName) {
-  if (TargetComponent && TargetComponent->AnimSequence != TargetSequence) {
-    Cleanup();
+  if (!IsTrackingComponent()) {
     return;
   }
 
@@ -98,11 +145,43 @@ void USCAnimAsyncAction::HandleNotify(FName NotifyName) {
       0.0);
 }
 
+void USCAnimAsyncAction::BindToComponent(USCCurveAnimComponent *Component) {
+  if (TargetComponent) {
+    TargetComponent->OnAnimationUpdateNative.RemoveAll(this);
+    TargetComponent->OnAnimationFinishedNative.RemoveAll(this);
+    TargetComponent->OnAnimationNotifyNative.RemoveAll(this);
+  }
+
+  TargetComponent = Component;
+  if (TargetComponent) {
+    TargetComponent->OnAnimationUpdateNative.AddUObject(
+        this, &USCAnimAsyncAction::HandleUpdate);
+    TargetComponent->OnAnimationFinishedNative.AddUObject(
+        this, &USCAnimAsyncAction::HandleFinished);
+    TargetComponent->OnAnimationNotifyNative.AddUObject(
+        this, &USCAnimAsyncAction::HandleNotify);
+  }
+}
+
 void USCAnimAsyncAction::Cleanup() {
   if (TargetComponent) {
-    TargetComponent->OnAnimationUpdate.RemoveAll(this);
-    TargetComponent->OnAnimationFinished.RemoveAll(this);
-    TargetComponent->OnAnimationNotify.RemoveAll(this);
+    TargetComponent->OnAnimationUpdateNative.RemoveAll(this);
+    TargetComponent->OnAnimationFinishedNative.RemoveAll(this);
+    TargetComponent->OnAnimationNotifyNative.RemoveAll(this);
   }
   SetReadyToDestroy();
 }
+
+bool USCAnimAsyncAction::IsTrackingComponent() const {
+  if (!TargetComponent) {
+    return false;
+  }
+  if (!TargetSequence && TargetSoftSequence.IsNull()) {
+    return true;
+  }
+  return TargetComponent->AnimSequence == GetExpectedSequence();
+}
+
+USCAnimSequence *USCAnimAsyncAction::GetExpectedSequence() const {
+  return TargetSequence ? TargetSequence.Get() : TargetSoftSequence.Get();
+}
@@ -0,0 +1,107 @@
+#include "Components/Animation/SCAnimEvalPlan.h"
+#include "Curves/RichCurve.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+#include "Math/RandomStream.h"
+#include "SimpleComp.h"
+
+#if !UE_BUILD_SHIPPING
+
+namespace SCAnimCurveBatchBenchmark {
+constexpr int32 NumLanes = 3;
+
+/** Fills the curves with random keys at shared times, mixing cubic, linear
+ * and constant segments, and lets the curves compute their tangents. */
+void MakeCurves(FRandomStream &Random, int32 NumKeys,
+                FRichCurve (&Curves)[NumLanes]) {
+  float Time = 0.0f;
+  for (int32 Key = 0; Key < NumKeys; ++Key) {
+    const int32 Mode = Random.RandRange(0, 9);
+    const ERichCurveInterpMode InterpMode =
+        Mode == 0 ? RCIM_Constant : (Mode == 1 ? RCIM_Linear : RCIM_Cubic);
+    for (FRichCurve &Curve : Curves) {
+      const FKeyHandle Handle =
+          Curve.AddKey(Time, Random.FRandRange(-100.0f, 100.0f));
+      Curve.SetKeyInterpMode(Handle, InterpMode);
+    }
+    Time += Random.FRandRange(0.01f, 0.5f);
+  }
+  for (FRichCurve &Curve : Curves) {
+    Curve.AutoSetTangents();
+  }
+}
+
+void Run(const TArray<FString> &Args) {
+  const int32 NumKeys =
+      Args.Num() > 0 ? FMath::Max(FCString::Atoi(*Args[0]), 1) : 16;
+  const int32 NumSamples =
+      Args.Num() > 1 ? FMath::Max(FCString::Atoi(*Args[1]), 1) : 1000000;
+
+  FRandomStream Random(NumKeys);
+  FRichCurve Curves[NumLanes];
+  MakeCurves(Random, NumKeys, Curves);
+
+  const FRichCurve *CurvePtrs[NumLanes] = {&Curves[0], &Curves[1],
+                                           &Curves[2]};
+  const float Scales[NumLanes] = {1.0f, 1.0f, 1.0f};
+  FSCAnimCurveBatch Batch;
+  Batch.Build(CurvePtrs, Scales);
+
+  float MinTime = 0.0f;
+  float MaxTime = 0.0f;
+  Curves[0].GetTimeRange(MinTime, MaxTime);
+  TArray<float> Times;
+  Times.SetNumUninitialized(NumSamples);
+  for (float &Time : Times) {
+    Time = Random.FRandRange(MinTime - 0.1f, MaxTime + 0.1f);
+  }
+
+  float MaxError = 0.0f;
+  for (const float Time : Times) {
+    alignas(16) float Lanes[FSCAnimCurveBatch::MaxChannels];
+    VectorStoreAligned(Batch.Evaluate(Time), Lanes);
+    for (int32 Lane = 0; Lane < NumLanes; ++Lane) {
+      const float Expected = Curves[Lane].Eval(Time);
+      const float Error = FMath::Abs(Lanes[Lane] - Expected) /
+                          FMath::Max(1.0f, FMath::Abs(Expected));
+      MaxError = FMath::Max(MaxError, Error);
+    }
+  }
+
+  float Sink = 0.0f;
+  double Start = FPlatformTime::Seconds();
+  for (const float Time : Times) {
+    for (const FRichCurve &Curve : Curves) {
+      Sink += Curve.Eval(Time);
+    }
+  }
+  const double ScalarSeconds = FPlatformTime::Seconds() - Start;
+
+  VectorRegister4Float BatchSink = VectorZeroFloat();
+  Start = FPlatformTime::Seconds();
+  for (const float Time : Times) {
+    BatchSink = VectorAdd(BatchSink, Batch.Evaluate(Time));
+  }
+  const double BatchSeconds = FPlatformTime::Seconds() - Start;
+  Sink += VectorGetComponent(BatchSink, 0);
+
+  constexpr float Tolerance = 1.0e-4f;
+  UE_LOG(LogSimpleComp, Display,
+         TEXT("Curve batch: %d keys, %d samples x %d channels. FRichCurve "
+              "%.2f ms, batch %.2f ms (%.2fx). Max relative error %g, %s "
+              "(checksum %g)."),
+         NumKeys, NumSamples, NumLanes, ScalarSeconds * 1000.0,
+         BatchSeconds * 1000.0, ScalarSeconds / FMath::Max(BatchSeconds, 1e-9),
+         MaxError, MaxError <= Tolerance ? TEXT("PASSED") : TEXT("FAILED"),
+         Sink);
+}
+
+FAutoConsoleCommand Command(
+    TEXT("SimpleComp.BenchmarkCurveBatch"),
+    TEXT("Compares FSCAnimCurveBatch with FRichCurve on random 3-channel "
+         "curves and reports timings and the largest relative error. "
+         "Arguments: [NumKeys=16] [NumSamples=1000000]"),
+    FConsoleCommandWithArgsDelegate::CreateStatic(&Run));
+} // namespace SCAnimCurveBatchBenchmark
+
+#endif
@@ -0,0 +1,31 @@
+#include "Components/Animation/SCAnimEvalCache.h"
+#include "Components/Animation/SCAnimSequence.h"
+
+FSCAnimEvalCache &FSCAnimEvalCache::Get() {
+  static FSCAnimEvalCache Cache;
+  return Cache;
+}
+
+FSCAnimChannelValues FSCAnimEvalCache::Evaluate(const FSCAnimEvalPlan &Plan,
+                                                float Time) {
+  check(IsInGameThread());
+
+  FSCAnimEvalCache &Cache = Get();
+  if (Cache.Frame != GFrameCounter) {
+    Cache.Frame = GFrameCounter;
+    Cache.Entries.Reset();
+  }
+
+  const USCAnimSequence *Sequence = Plan.GetSequence();
+  const FKey Key{Sequence,
+                 Sequence ? Sequence->GetEvaluationVersion() : 0u,
+                 FMath::RoundToInt(Time / TimeStep)};
+
+  if (const FSCAnimChannelValues *Cached = Cache.Entries.Find(Key)) {
+    return *Cached;
+  }
+
+  FSCAnimChannelValues &Values = Cache.Entries.Add(Key);
+  Plan.Evaluate(Key.QuantizedTime * TimeStep, Values);
+  return Values;
+}
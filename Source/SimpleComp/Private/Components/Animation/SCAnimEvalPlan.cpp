@@ -0,0 +1,543 @@
+#include "Components/Animation/SCAnimEvalPlan.h"
+#include "Components/Animation/SCAnimSequence.h"
+#include "Algo/BinarySearch.h"
+#include "Curves/RichCurve.h"
+
+namespace SCAnimEvalPlan {
+int32 GetFirstChannel(ESCCurveTrackType TrackType, int32 NumChannels) {
+  if (NumChannels == 1 && TrackType <= ESCCurveTrackType::ScaleZ) {
+    return static_cast<int32>(TrackType);
+  }
+  if (NumChannels == 3) {
+    switch (TrackType) {
+    case ESCCurveTrackType::VectorLocation:
+      return SCAnimChannel::LocationX;
+    case ESCCurveTrackType::VectorRotation:
+      return SCAnimChannel::RotationP;
+    case ESCCurveTrackType::VectorScale:
+      return SCAnimChannel::ScaleX;
+    default:
+      break;
+    }
+  }
+  return INDEX_NONE;
+}
+
+/** Returns 0 for tracks driving the animating component, else 1 + the index
+ * of their target, adding it if needed. INDEX_NONE if there are too many. */
+int32 FindOrAddTarget(const FSCCurveTrack &Track,
+                      TArray<FSCAnimPlanTarget> &Targets) {
+  if (Track.TargetType == ESCAnimTargetType::Self) {
+    return 0;
+  }
+
+  int32 Index = Targets.IndexOfByPredicate(
+      [&Track](const FSCAnimPlanTarget &Target) {
+        return Target.Type == Track.TargetType &&
+               Target.Name == Track.TargetName;
+      });
+  if (Index == INDEX_NONE) {
+    if (Targets.Num() >= MAX_uint8 - 1) {
+      return INDEX_NONE;
+    }
+    FSCAnimPlanTarget &Target = Targets.AddDefaulted_GetRef();
+    Target.Type = Track.TargetType;
+    Target.Name = Track.TargetName;
+    Index = Targets.Num() - 1;
+  }
+  return Index + 1;
+}
+
+template <typename OpType>
+int32 SortByTarget(TArray<OpType> &Ops) {
+  Ops.StableSort(
+      [](const OpType &A, const OpType &B) { return A.Target < B.Target; });
+  return Algo::LowerBoundBy(Ops, 1, &OpType::Target);
+}
+
+FTransform ComposeChannels(const FSCAnimChannelValues &Values,
+                           uint16 WriteMask, uint16 AdditiveMask,
+                           const FVector &BaseLocation,
+                           const FRotator &BaseRotation,
+                           const FVector &BaseScale) {
+  double Channels[SCAnimChannel::Num] = {
+      BaseLocation.X,     BaseLocation.Y,   BaseLocation.Z,
+      BaseRotation.Pitch, BaseRotation.Yaw, BaseRotation.Roll,
+      BaseScale.X,        BaseScale.Y,      BaseScale.Z};
+
+  for (int32 Channel = 0; Channel < SCAnimChannel::Num; ++Channel) {
+    const uint16 Bit = 1 << Channel;
+    if (WriteMask & Bit) {
+      Channels[Channel] = (AdditiveMask & Bit)
+                              ? Channels[Channel] + Values.Values[Channel]
+                              : Values.Values[Channel];
+    }
+  }
+
+  return FTransform(
+      FRotator(Channels[SCAnimChannel::RotationP],
+               Channels[SCAnimChannel::RotationY],
+               Channels[SCAnimChannel::RotationR]),
+      FVector(Channels[SCAnimChannel::LocationX],
+              Channels[SCAnimChannel::LocationY],
+              Channels[SCAnimChannel::LocationZ]),
+      FVector(Channels[SCAnimChannel::ScaleX], Channels[SCAnimChannel::ScaleY],
+              Channels[SCAnimChannel::ScaleZ]));
+}
+} // namespace SCAnimEvalPlan
+
+bool FSCAnimCurveBatch::CanBatch(const FRichCurve &Curve) {
+  if (Curve.GetNumKeys() == 0 || Curve.PreInfinityExtrap != RCCE_Constant ||
+      Curve.PostInfinityExtrap != RCCE_Constant) {
+    return false;
+  }
+  for (const FRichCurveKey &Key : Curve.GetConstRefOfKeys()) {
+    if (Key.TangentWeightMode != RCTWM_WeightedNone) {
+      return false;
+    }
+  }
+  return true;
+}
+
+bool FSCAnimCurveBatch::HaveSameKeyTimes(const FRichCurve &A,
+                                         const FRichCurve &B) {
+  const TArray<FRichCurveKey> &KeysA = A.GetConstRefOfKeys();
+  const TArray<FRichCurveKey> &KeysB = B.GetConstRefOfKeys();
+  if (KeysA.Num() != KeysB.Num()) {
+    return false;
+  }
+  for (int32 Index = 0; Index < KeysA.Num(); ++Index) {
+    if (KeysA[Index].Time != KeysB[Index].Time) {
+      return false;
+    }
+  }
+  return true;
+}
+
+void FSCAnimCurveBatch::Build(TArrayView<const FRichCurve *const> Curves,
+                              TArrayView<const float> Scales) {
+  check(Curves.Num() > 0 && Curves.Num() <= MaxChannels);
+  check(Curves.Num() == Scales.Num());
+
+  NumChannels = Curves.Num();
+  const TArray<FRichCurveKey> &TimeKeys = Curves[0]->GetConstRefOfKeys();
+  const int32 NumKeys = TimeKeys.Num();
+  const int32 NumSegments = NumKeys - 1;
+
+  KeyTimes.SetNumUninitialized(NumKeys);
+  for (int32 Index = 0; Index < NumKeys; ++Index) {
+    KeyTimes[Index] = TimeKeys[Index].Time;
+  }
+
+  InvDurations.SetNumZeroed(NumSegments);
+  Coefficients.SetNumZeroed(NumSegments * 16);
+  FMemory::Memzero(FirstValues);
+  FMemory::Memzero(LastValues);
+
+  for (int32 Lane = 0; Lane < NumChannels; ++Lane) {
+    const TArray<FRichCurveKey> &Keys = Curves[Lane]->GetConstRefOfKeys();
+    const float Scale = Scales[Lane];
+    FirstValues[Lane] = Keys[0].Value * Scale;
+    LastValues[Lane] = Keys.Last().Value * Scale;
+
+    for (int32 Segment = 0; Segment < NumSegments; ++Segment) {
+      const FRichCurveKey &Key1 = Keys[Segment];
+      const FRichCurveKey &Key2 = Keys[Segment + 1];
+      const float Diff = Key2.Time - Key1.Time;
+      const float P0 = Key1.Value;
+      const float P3 = Key2.Value;
+      float A = 0.0f;
+      float B = 0.0f;
+      float C = 0.0f;
+
+      if (Diff > 0.0f) {
+        InvDurations[Segment] = 1.0f / Diff;
+        if (Key1.InterpMode == RCIM_Linear) {
+          C = P3 - P0;
+        } else if (Key1.InterpMode != RCIM_Constant) {
+          const float P1 = P0 + Key1.LeaveTangent * Diff / 3.0f;
+          const float P2 = P3 - Key2.ArriveTangent * Diff / 3.0f;
+          A = P3 - P0 + 3.0f * (P1 - P2);
+          B = 3.0f * (P0 - 2.0f * P1 + P2);
+          C = 3.0f * (P1 - P0);
+        }
+      }
+
+      float *SegmentCoefficients = &Coefficients[Segment * 16];
+      SegmentCoefficients[Lane] = A * Scale;
+      SegmentCoefficients[4 + Lane] = B * Scale;
+      SegmentCoefficients[8 + Lane] = C * Scale;
+      SegmentCoefficients[12 + Lane] = P0 * Scale;
+    }
+  }
+}
+
+VectorRegister4Float FSCAnimCurveBatch::Evaluate(float Time) const {
+  if (Time <= KeyTimes[0]) {
+    return VectorLoad(FirstValues);
+  }
+  if (Time >= KeyTimes.Last()) {
+    return VectorLoad(LastValues);
+  }
+
+  const int32 Segment = Algo::UpperBound(KeyTimes, Time) - 1;
+  const VectorRegister4Float Alpha = VectorSetFloat1(
+      (Time - KeyTimes[Segment]) * InvDurations[Segment]);
+  const float *Terms = &Coefficients[Segment * 16];
+
+  VectorRegister4Float Result = VectorLoad(Terms);
+  Result = VectorMultiplyAdd(Result, Alpha, VectorLoad(Terms + 4));
+  Result = VectorMultiplyAdd(Result, Alpha, VectorLoad(Terms + 8));
+  return VectorMultiplyAdd(Result, Alpha, VectorLoad(Terms + 12));
+}
+
+FSCAnimPlaybackStep SCAnimPlayback::Advance(float Time, float DeltaTime,
+                                            float Rate, float Direction,
+                                            float Duration, bool bLoop) {
+  FSCAnimPlaybackStep Step;
+  Step.PrevTime = Time;
+  Step.Time = Time + DeltaTime * Rate * Direction;
+  Step.Direction = Direction;
+
+  if (Direction > 0.0f && Step.Time >= Duration) {
+    if (bLoop) {
+      Step.NumWraps = FMath::FloorToInt(Step.Time / Duration);
+      Step.Time = FMath::Clamp(Step.Time - Step.NumWraps * Duration, 0.0f,
+                               Duration);
+    } else {
+      Step.Excess = Step.Time - Duration;
+      Step.Time = Duration;
+      Step.bFinished = true;
+    }
+  } else if (Direction < 0.0f && Step.Time <= 0.0f) {
+    if (bLoop) {
+      Step.NumWraps = FMath::FloorToInt(-Step.Time / Duration) + 1;
+      Step.Time = FMath::Clamp(Step.Time + Step.NumWraps * Duration, 0.0f,
+                               Duration);
+    } else {
+      Step.Excess = -Step.Time;
+      Step.Time = 0.0f;
+      Step.bFinished = true;
+    }
+  }
+  return Step;
+}
+
+void FSCAnimEvalPlan::Build(const USCAnimSequence *InSequence) {
+  Reset();
+
+  if (!InSequence) {
+    return;
+  }
+
+  Sequence = InSequence;
+  SequenceVersion = InSequence->GetEvaluationVersion();
+  ReferenceDuration = InSequence->GetReferenceDuration();
+  BakedData = InSequence->GetBakedData();
+  CompressedData = InSequence->GetCompressedData();
+
+  const TArray<FSCCurveTrack> &Tracks = InSequence->CurveTracks;
+  for (int32 TrackIndex = Tracks.Num() - 1; TrackIndex >= 0; --TrackIndex) {
+    const FSCCurveTrack &Track = Tracks[TrackIndex];
+    const int32 NumChannels = Track.GetNumChannels();
+    if (Track.TrackType == ESCCurveTrackType::CustomFloat) {
+      if (NumChannels == 1) {
+        AddCustomOp(Track, TrackIndex);
+      }
+      continue;
+    }
+
+    const int32 FirstChannel =
+        SCAnimEvalPlan::GetFirstChannel(Track.TrackType, NumChannels);
+    if (FirstChannel == INDEX_NONE) {
+      continue;
+    }
+
+    const int32 Target = SCAnimEvalPlan::FindOrAddTarget(Track, BoundTargets);
+    if (Target == INDEX_NONE) {
+      continue;
+    }
+    uint16 &TargetWriteMask =
+        Target == 0 ? WriteMask : BoundTargets[Target - 1].WriteMask;
+    uint16 &TargetAdditiveMask =
+        Target == 0 ? AdditiveMask : BoundTargets[Target - 1].AdditiveMask;
+
+    const int32 BakedChannel =
+        BakedData ? BakedData->GetTrackChannel(TrackIndex) : INDEX_NONE;
+    const int32 CompressedChannel =
+        CompressedData ? CompressedData->GetTrackChannel(TrackIndex)
+                       : INDEX_NONE;
+
+    for (int32 Offset = 0; Offset < NumChannels; ++Offset) {
+      const uint8 Channel = static_cast<uint8>(FirstChannel + Offset);
+      const uint16 Bit = 1 << Channel;
+      if (TargetWriteMask & Bit) {
+        continue;
+      }
+
+      TargetWriteMask |= Bit;
+      if (Track.bAddBaseValue) {
+        TargetAdditiveMask |= Bit;
+      }
+
+      const float Scale = NumChannels == 1
+                              ? Track.ScaleFloat
+                              : static_cast<float>(Track.ScaleVector[Offset]);
+      const uint8 OpTarget = static_cast<uint8>(Target);
+      if (BakedChannel != INDEX_NONE) {
+        BakedOps.Add({BakedChannel + Offset, Scale, Channel, OpTarget});
+      } else if (CompressedChannel != INDEX_NONE) {
+        CompressedOps.Add(
+            {CompressedChannel + Offset, Scale, Channel, OpTarget});
+      } else {
+        CurveOps.Add(
+            {Track.GetChannelCurve(Offset), Scale, Channel, OpTarget});
+        PinSoftCurve(Track);
+      }
+    }
+  }
+
+  BuildCurveBatches();
+  NumSelfCurveOps = SCAnimEvalPlan::SortByTarget(CurveOps);
+  NumSelfCurveBatches = SCAnimEvalPlan::SortByTarget(CurveBatches);
+  NumSelfBakedOps = SCAnimEvalPlan::SortByTarget(BakedOps);
+  NumSelfCompressedOps = SCAnimEvalPlan::SortByTarget(CompressedOps);
+  CustomOps.Sort([](const FSCAnimCustomOp &A, const FSCAnimCustomOp &B) {
+    return A.Target != B.Target ? A.Target < B.Target
+                                : A.DataIndex < B.DataIndex;
+  });
+  NumSelfCustomOps = Algo::LowerBoundBy(CustomOps, 1, &FSCAnimCustomOp::Target);
+
+  Notifies.Reserve(InSequence->Notifies.Num());
+  for (const FSCAnimNotify &Notify : InSequence->Notifies) {
+    Notifies.Add({Notify.Time, Notify.NotifyName});
+  }
+  Notifies.StableSort(
+      [](const FSCAnimPlanNotify &A, const FSCAnimPlanNotify &B) {
+        return A.Time < B.Time;
+      });
+}
+
+void FSCAnimEvalPlan::BuildCurveBatches() {
+  TBitArray<> Batched(false, CurveOps.Num());
+  for (int32 First = 0; First < CurveOps.Num(); ++First) {
+    const FSCAnimCurveOp &FirstOp = CurveOps[First];
+    if (Batched[First] || !FSCAnimCurveBatch::CanBatch(*FirstOp.Curve)) {
+      continue;
+    }
+
+    TArray<int32, TInlineAllocator<FSCAnimCurveBatch::MaxChannels>> Members;
+    Members.Add(First);
+    for (int32 Other = First + 1; Other < CurveOps.Num(); ++Other) {
+      const FSCAnimCurveOp &OtherOp = CurveOps[Other];
+      if (Members.Num() == FSCAnimCurveBatch::MaxChannels) {
+        break;
+      }
+      if (!Batched[Other] && OtherOp.Target == FirstOp.Target &&
+          FSCAnimCurveBatch::CanBatch(*OtherOp.Curve) &&
+          FSCAnimCurveBatch::HaveSameKeyTimes(*FirstOp.Curve,
+                                              *OtherOp.Curve)) {
+        Members.Add(Other);
+      }
+    }
+    if (Members.Num() < 2) {
+      continue;
+    }
+
+    const FRichCurve *Curves[FSCAnimCurveBatch::MaxChannels];
+    float Scales[FSCAnimCurveBatch::MaxChannels];
+    FSCAnimCurveBatch &Batch = CurveBatches.AddDefaulted_GetRef();
+    for (int32 Lane = 0; Lane < Members.Num(); ++Lane) {
+      const FSCAnimCurveOp &Op = CurveOps[Members[Lane]];
+      Curves[Lane] = Op.Curve;
+      Scales[Lane] = Op.Scale;
+      Batch.Channels[Lane] = Op.Channel;
+      Batched[Members[Lane]] = true;
+    }
+    Batch.Target = FirstOp.Target;
+    Batch.Build(MakeArrayView(Curves, Members.Num()),
+                MakeArrayView(Scales, Members.Num()));
+  }
+
+  int32 NumKept = 0;
+  for (int32 Index = 0; Index < CurveOps.Num(); ++Index) {
+    if (!Batched[Index]) {
+      CurveOps[NumKept++] = CurveOps[Index];
+    }
+  }
+  CurveOps.SetNum(NumKept);
+}
+
+void FSCAnimEvalPlan::AddCustomOp(const FSCCurveTrack &Track,
+                                  int32 TrackIndex) {
+  const int32 Target = SCAnimEvalPlan::FindOrAddTarget(Track, BoundTargets);
+  if (Target == INDEX_NONE || Track.CustomDataIndex < 0) {
+    return;
+  }
+
+  const bool bOverridden = CustomOps.ContainsByPredicate(
+      [&Track, Target](const FSCAnimCustomOp &Op) {
+        return Op.Target == Target && Op.DataIndex == Track.CustomDataIndex;
+      });
+  if (bOverridden) {
+    return;
+  }
+
+  FSCAnimCustomOp &Op = CustomOps.AddDefaulted_GetRef();
+  Op.BakedChannel =
+      BakedData ? BakedData->GetTrackChannel(TrackIndex) : INDEX_NONE;
+  Op.CompressedChannel =
+      CompressedData ? CompressedData->GetTrackChannel(TrackIndex)
+                     : INDEX_NONE;
+  if (Op.BakedChannel == INDEX_NONE && Op.CompressedChannel == INDEX_NONE) {
+    Op.Curve = Track.GetChannelCurve(0);
+    PinSoftCurve(Track);
+  }
+  Op.Scale = Track.ScaleFloat;
+  Op.DataIndex = Track.CustomDataIndex;
+  Op.Target = static_cast<uint8>(Target);
+}
+
+void FSCAnimEvalPlan::PinSoftCurve(const FSCCurveTrack &Track) {
+  if (Track.bInlineCurve || Track.CurveAsset) {
+    return;
+  }
+
+  UCurveBase *Asset = Track.SoftCurveAsset.Get();
+  const bool bPinned = SoftCurves.ContainsByPredicate(
+      [Asset](const TStrongObjectPtr<UCurveBase> &Pinned) {
+        return Pinned.Get() == Asset;
+      });
+  if (Asset && !bPinned) {
+    SoftCurves.Emplace(Asset);
+  }
+}
+
+void FSCAnimEvalPlan::Reset() {
+  Sequence = nullptr;
+  BakedData = nullptr;
+  CompressedData = nullptr;
+  SequenceVersion = 0;
+  ReferenceDuration = 0.0f;
+  WriteMask = 0;
+  AdditiveMask = 0;
+  CurveOps.Reset();
+  CurveBatches.Reset();
+  NumSelfCurveBatches = 0;
+  BakedOps.Reset();
+  CompressedOps.Reset();
+  NumSelfCurveOps = 0;
+  NumSelfBakedOps = 0;
+  NumSelfCompressedOps = 0;
+  CustomOps.Reset();
+  NumSelfCustomOps = 0;
+  BoundTargets.Reset();
+  Notifies.Reset();
+  SoftCurves.Reset();
+}
+
+bool FSCAnimEvalPlan::IsBuiltFor(const USCAnimSequence *InSequence) const {
+  return InSequence && Sequence == InSequence &&
+         SequenceVersion == InSequence->GetEvaluationVersion();
+}
+
+int32 FSCAnimEvalPlan::CountNotifiesAtOrBefore(float Time) const {
+  return Algo::UpperBoundBy(Notifies, Time, &FSCAnimPlanNotify::Time);
+}
+
+int32 FSCAnimEvalPlan::CountNotifiesBefore(float Time) const {
+  return Algo::LowerBoundBy(Notifies, Time, &FSCAnimPlanNotify::Time);
+}
+
+void FSCAnimEvalPlan::Evaluate(float Time,
+                               FSCAnimChannelValues &OutValues) const {
+  for (const FSCAnimCurveBatch &Batch :
+       MakeArrayView(CurveBatches).Left(NumSelfCurveBatches)) {
+    alignas(16) float Lanes[FSCAnimCurveBatch::MaxChannels];
+    VectorStoreAligned(Batch.Evaluate(Time), Lanes);
+    for (int32 Lane = 0; Lane < Batch.NumChannels; ++Lane) {
+      OutValues.Values[Batch.Channels[Lane]] = Lanes[Lane];
+    }
+  }
+  for (const FSCAnimCurveOp &Op :
+       MakeArrayView(CurveOps).Left(NumSelfCurveOps)) {
+    OutValues.Values[Op.Channel] = Op.Curve->Eval(Time) * Op.Scale;
+  }
+  for (const FSCAnimBakedOp &Op :
+       MakeArrayView(BakedOps).Left(NumSelfBakedOps)) {
+    OutValues.Values[Op.Channel] =
+        BakedData->SampleChannel(Op.BakedChannel, Time) * Op.Scale;
+  }
+  for (const FSCAnimCompressedOp &Op :
+       MakeArrayView(CompressedOps).Left(NumSelfCompressedOps)) {
+    OutValues.Values[Op.Channel] =
+        CompressedData->SampleChannel(Op.CompressedChannel, Time) * Op.Scale;
+  }
+}
+
+void FSCAnimEvalPlan::EvaluateBound(
+    float Time, TArrayView<FSCAnimChannelValues> OutValues) const {
+  check(OutValues.Num() == BoundTargets.Num());
+
+  for (const FSCAnimCurveBatch &Batch :
+       MakeArrayView(CurveBatches).RightChop(NumSelfCurveBatches)) {
+    alignas(16) float Lanes[FSCAnimCurveBatch::MaxChannels];
+    VectorStoreAligned(Batch.Evaluate(Time), Lanes);
+    FSCAnimChannelValues &Values = OutValues[Batch.Target - 1];
+    for (int32 Lane = 0; Lane < Batch.NumChannels; ++Lane) {
+      Values.Values[Batch.Channels[Lane]] = Lanes[Lane];
+    }
+  }
+
+  for (const FSCAnimCurveOp &Op :
+       MakeArrayView(CurveOps).RightChop(NumSelfCurveOps)) {
+    OutValues[Op.Target - 1].Values[Op.Channel] =
+        Op.Curve->Eval(Time) * Op.Scale;
+  }
+  for (const FSCAnimBakedOp &Op :
+       MakeArrayView(BakedOps).RightChop(NumSelfBakedOps)) {
+    OutValues[Op.Target - 1].Values[Op.Channel] =
+        BakedData->SampleChannel(Op.BakedChannel, Time) * Op.Scale;
+  }
+  for (const FSCAnimCompressedOp &Op :
+       MakeArrayView(CompressedOps).RightChop(NumSelfCompressedOps)) {
+    OutValues[Op.Target - 1].Values[Op.Channel] =
+        CompressedData->SampleChannel(Op.CompressedChannel, Time) * Op.Scale;
+  }
+}
+
+void FSCAnimEvalPlan::EvaluateCustom(float Time,
+                                     TArrayView<float> OutValues) const {
+  check(OutValues.Num() <= CustomOps.Num());
+
+  for (int32 Index = 0; Index < OutValues.Num(); ++Index) {
+    const FSCAnimCustomOp &Op = CustomOps[Index];
+    float Value;
+    if (Op.BakedChannel != INDEX_NONE) {
+      Value = BakedData->SampleChannel(Op.BakedChannel, Time);
+    } else if (Op.CompressedChannel != INDEX_NONE) {
+      Value = CompressedData->SampleChannel(Op.CompressedChannel, Time);
+    } else {
+      Value = Op.Curve->Eval(Time);
+    }
+    OutValues[Index] = Value * Op.Scale;
+  }
+}
+
+FTransform FSCAnimEvalPlan::Compose(const FSCAnimChannelValues &Values,
+                                    const FVector &BaseLocation,
+                                    const FRotator &BaseRotation,
+                                    const FVector &BaseScale) const {
+  return SCAnimEvalPlan::ComposeChannels(Values, WriteMask, AdditiveMask,
+                                         BaseLocation, BaseRotation,
+                                         BaseScale);
+}
+
+FTransform FSCAnimEvalPlan::ComposeBound(int32 TargetIndex,
+                                         const FSCAnimChannelValues &Values,
+                                         const FTransform &Base) const {
+  const FSCAnimPlanTarget &Target = BoundTargets[TargetIndex];
+  return SCAnimEvalPlan::ComposeChannels(
+      Values, Target.WriteMask, Target.AdditiveMask, Base.GetLocation(),
+      Base.Rotator(), Base.GetScale3D());
+}
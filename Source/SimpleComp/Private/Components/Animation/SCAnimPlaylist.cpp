@@ -0,0 +1,62 @@
+#include "Components/Animation/SCAnimPlaylist.h"
+#include "Components/Animation/SCAnimSequence.h"
+
+int32 USCAnimPlaylist::GetNumPlayableEntries() const {
+  int32 NumPlayable = 0;
+  for (int32 Index = 0; Index < Entries.Num(); ++Index) {
+    NumPlayable += IsPlayable(Index) ? 1 : 0;
+  }
+  return NumPlayable;
+}
+
+int32 USCAnimPlaylist::PickEntry(int32 Previous, FRandomStream &Random) const {
+  const int32 NumEntries = Entries.Num();
+  if (Order == ESCAnimPlaylistOrder::Sequential) {
+    for (int32 Offset = 1; Offset <= NumEntries; ++Offset) {
+      const int32 Index = (Previous + Offset) % NumEntries;
+      if (IsPlayable(Index)) {
+        return Index;
+      }
+    }
+    return INDEX_NONE;
+  }
+
+  const bool bExcludePrevious =
+      bAvoidRepeats && IsPlayable(Previous) && GetNumPlayableEntries() > 1;
+  float TotalWeight = 0.0f;
+  for (int32 Index = 0; Index < NumEntries; ++Index) {
+    if (IsPlayable(Index) && !(bExcludePrevious && Index == Previous)) {
+      TotalWeight += Entries[Index].Weight;
+    }
+  }
+
+  float Pick = Random.FRandRange(0.0f, TotalWeight);
+  int32 Picked = INDEX_NONE;
+  for (int32 Index = 0; Index < NumEntries; ++Index) {
+    if (IsPlayable(Index) && !(bExcludePrevious && Index == Previous)) {
+      Picked = Index;
+      Pick -= Entries[Index].Weight;
+      if (Pick < 0.0f) {
+        break;
+      }
+    }
+  }
+  return Picked;
+}
+
+bool USCAnimPlaylist::IsPlayable(int32 EntryIndex) const {
+  if (!Entries.IsValidIndex(EntryIndex)) {
+    return false;
+  }
+  const FSCAnimPlaylistEntry &Entry = Entries[EntryIndex];
+  if (!Entry.Sequence ||
+      (Order == ESCAnimPlaylistOrder::Random && Entry.Weight <= 0.0f)) {
+    return false;
+  }
+  // An entry without length would finish on every update and never let the
+  // playlist advance time.
+  const float Duration = Entry.Duration > 0.0f
+                             ? Entry.Duration
+                             : Entry.Sequence->GetReferenceDuration();
+  return Duration > 0.0f;
+}
@@ -1,4 +1,242 @@
 #include "Components/Animation/SCAnimSequence.h"
+#include "Algo/BinarySearch.h"
+#include "Curves/CurveFloat.h"
+#include "Curves/CurveVector.h"
+#include "SimpleComp.h"
+#include "UObject/AssetRegistryTagsContext.h"
+#include "UObject/ObjectSaveContext.h"
+
+namespace SCAnimSequence {
+constexpr int32 MaxBakedSamples = 65536;
+constexpr float QuantizedRange = 65535.0f;
+
+/** Separates the names in NotifyNamesTag. Names containing it, or the escape
+ * character, have those characters prefixed with TagEscape. */
+constexpr TCHAR TagDelimiter = TEXT(',');
+constexpr TCHAR TagEscape = TEXT('\\');
+
+bool IsVectorTrack(ESCCurveTrackType TrackType) {
+  return TrackType == ESCCurveTrackType::VectorLocation ||
+         TrackType == ESCCurveTrackType::VectorRotation ||
+         TrackType == ESCCurveTrackType::VectorScale;
+}
+
+void GetSampleGrid(float Duration, float Rate, int32 &OutNumSamples,
+                   float &OutSampleRate) {
+  OutNumSamples = FMath::Clamp(FMath::CeilToInt(Duration * Rate), 1,
+                               MaxBakedSamples - 1) +
+                  1;
+  OutSampleRate = static_cast<float>(OutNumSamples - 1) / Duration;
+}
+
+/**
+ * Selects the samples to keep as linear keys so every dropped sample lies
+ * within Tolerance of the line between its neighbouring keys. The first and
+ * last samples are always kept.
+ */
+void ReduceKeys(const TArray<float> &Samples, float Tolerance,
+                TArray<int32> &OutKeys) {
+  const int32 NumSamples = Samples.Num();
+  TBitArray<> Keep(false, NumSamples);
+  Keep[0] = true;
+  Keep[NumSamples - 1] = true;
+
+  TArray<TPair<int32, int32>, TInlineAllocator<32>> Segments;
+  Segments.Emplace(0, NumSamples - 1);
+  while (Segments.Num() > 0) {
+    const TPair<int32, int32> Segment = Segments.Pop();
+    const int32 First = Segment.Key;
+    const int32 Last = Segment.Value;
+
+    float MaxError = Tolerance;
+    int32 MaxIndex = INDEX_NONE;
+    for (int32 Index = First + 1; Index < Last; ++Index) {
+      const float Alpha =
+          static_cast<float>(Index - First) / static_cast<float>(Last - First);
+      const float Error = FMath::Abs(
+          Samples[Index] - FMath::Lerp(Samples[First], Samples[Last], Alpha));
+      if (Error > MaxError) {
+        MaxError = Error;
+        MaxIndex = Index;
+      }
+    }
+
+    if (MaxIndex != INDEX_NONE) {
+      Keep[MaxIndex] = true;
+      Segments.Emplace(First, MaxIndex);
+      Segments.Emplace(MaxIndex, Last);
+    }
+  }
+
+  OutKeys.Reset();
+  for (TConstSetBitIterator<> It(Keep); It; ++It) {
+    OutKeys.Add(It.GetIndex());
+  }
+}
+} // namespace SCAnimSequence
+
+UCurveBase *FSCCurveTrack::GetCurveAsset() const {
+  return CurveAsset ? CurveAsset.Get() : SoftCurveAsset.Get();
+}
+
+int32 FSCCurveTrack::GetNumChannels() const {
+  if (StrippedNumChannels > 0) {
+    return StrippedNumChannels;
+  }
+  if (bInlineCurve) {
+    const int32 NumChannels = SCAnimSequence::IsVectorTrack(TrackType) ? 3 : 1;
+    for (int32 Channel = 0; Channel < NumChannels; ++Channel) {
+      if (GetChannelCurve(Channel)->GetNumKeys() > 0) {
+        return NumChannels;
+      }
+    }
+    return 0;
+  }
+  const UCurveBase *Asset = GetCurveAsset();
+  if (Cast<UCurveFloat>(Asset)) {
+    return 1;
+  }
+  if (Cast<UCurveVector>(Asset)) {
+    return 3;
+  }
+  return 0;
+}
+
+const FRichCurve *FSCCurveTrack::GetChannelCurve(int32 Channel) const {
+  if (bInlineCurve) {
+    if (SCAnimSequence::IsVectorTrack(TrackType)) {
+      return (Channel >= 0 && Channel < 3)
+                 ? InlineVectorCurve.GetRichCurveConst(Channel)
+                 : nullptr;
+    }
+    return Channel == 0 ? InlineFloatCurve.GetRichCurveConst() : nullptr;
+  }
+  const UCurveBase *Asset = GetCurveAsset();
+  if (const UCurveFloat *FloatCurve = Cast<UCurveFloat>(Asset)) {
+    return Channel == 0 ? &FloatCurve->FloatCurve : nullptr;
+  }
+  if (const UCurveVector *VectorCurve = Cast<UCurveVector>(Asset)) {
+    return (Channel >= 0 && Channel < 3) ? &VectorCurve->FloatCurves[Channel]
+                                         : nullptr;
+  }
+  return nullptr;
+}
+
+bool FSCCurveTrack::GetTimeRange(float &OutMinTime, float &OutMaxTime) const {
+  bool bHasKeys = false;
+  OutMinTime = TNumericLimits<float>::Max();
+  OutMaxTime = TNumericLimits<float>::Lowest();
+
+  for (int32 Channel = 0; Channel < GetNumChannels(); ++Channel) {
+    const FRichCurve *Curve = GetChannelCurve(Channel);
+    if (Curve && Curve->GetNumKeys() > 0) {
+      float MinTime, MaxTime;
+      Curve->GetTimeRange(MinTime, MaxTime);
+      OutMinTime = FMath::Min(OutMinTime, MinTime);
+      OutMaxTime = FMath::Max(OutMaxTime, MaxTime);
+      bHasKeys = true;
+    }
+  }
+  return bHasKeys;
+}
+
+bool FSCCurveTrack::ConvertToInline() {
+  if (bInlineCurve) {
+    return false;
+  }
+
+  const UCurveBase *Asset =
+      CurveAsset ? CurveAsset.Get() : SoftCurveAsset.LoadSynchronous();
+  if (!Asset) {
+    return false;
+  }
+
+  const bool bVectorTrack = SCAnimSequence::IsVectorTrack(TrackType);
+  const UCurveFloat *FloatCurve = Cast<UCurveFloat>(Asset);
+  const UCurveVector *VectorCurve = Cast<UCurveVector>(Asset);
+
+  if (FloatCurve && !bVectorTrack) {
+    InlineFloatCurve.EditorCurveData = FloatCurve->FloatCurve;
+    InlineFloatCurve.ExternalCurve = nullptr;
+  } else if (VectorCurve && bVectorTrack) {
+    for (int32 Channel = 0; Channel < 3; ++Channel) {
+      InlineVectorCurve.VectorCurves[Channel] =
+          VectorCurve->FloatCurves[Channel];
+    }
+    InlineVectorCurve.ExternalCurve = nullptr;
+  } else {
+    return false;
+  }
+
+  bInlineCurve = true;
+  CurveAsset = nullptr;
+  SoftCurveAsset.Reset();
+  return true;
+}
+
+float FSCAnimBakedData::SampleChannel(int32 Channel, float Time) const {
+  const float Position =
+      FMath::Clamp(Time * SampleRate, 0.0f, static_cast<float>(NumSamples - 1));
+  const int32 Index = FMath::Min(static_cast<int32>(Position), NumSamples - 2);
+  const float Alpha = Position - static_cast<float>(Index);
+  const int32 Offset = Channel * NumSamples + Index;
+
+  if (IsQuantized()) {
+    const float A = ChannelMin[Channel] +
+                    ChannelStep[Channel] * QuantizedSamples[Offset];
+    const float B = ChannelMin[Channel] +
+                    ChannelStep[Channel] * QuantizedSamples[Offset + 1];
+    return FMath::Lerp(A, B, Alpha);
+  }
+  return FMath::Lerp(Samples[Offset], Samples[Offset + 1], Alpha);
+}
+
+void FSCAnimBakedData::Reset() {
+  SampleRate = 0.0f;
+  NumSamples = 0;
+  TrackChannels.Reset();
+  Samples.Reset();
+  QuantizedSamples.Reset();
+  ChannelMin.Reset();
+  ChannelStep.Reset();
+}
+
+float FSCAnimCompressedData::SampleChannel(int32 Channel, float Time) const {
+  const int32 First = KeyOffsets[Channel];
+  const int32 Last = KeyOffsets[Channel + 1] - 1;
+  const float Position = FMath::Clamp(Time * SampleRate, 0.0f,
+                                      static_cast<float>(KeyTimes[Last]));
+
+  const int32 Upper =
+      First + FMath::Clamp(Algo::UpperBound(MakeArrayView(&KeyTimes[First],
+                                                          Last - First + 1),
+                                            Position),
+                           1, Last - First);
+  const int32 Lower = Upper - 1;
+  const float Alpha = (Position - KeyTimes[Lower]) /
+                      static_cast<float>(KeyTimes[Upper] - KeyTimes[Lower]);
+
+  const float A = ChannelMin[Channel] + ChannelStep[Channel] * KeyValues[Lower];
+  const float B = ChannelMin[Channel] + ChannelStep[Channel] * KeyValues[Upper];
+  return FMath::Lerp(A, B, Alpha);
+}
+
+int32 FSCAnimCompressedData::GetDataSize() const {
+  return sizeof(SampleRate) + TrackChannels.Num() * sizeof(int32) +
+         KeyOffsets.Num() * sizeof(int32) + KeyTimes.Num() * sizeof(uint16) +
+         KeyValues.Num() * sizeof(uint16) + ChannelMin.Num() * sizeof(float) +
+         ChannelStep.Num() * sizeof(float);
+}
+
+void FSCAnimCompressedData::Reset() {
+  SampleRate = 0.0f;
+  TrackChannels.Reset();
+  KeyOffsets.Reset();
+  KeyTimes.Reset();
+  KeyValues.Reset();
+  ChannelMin.Reset();
+  ChannelStep.Reset();
+}
 
 TArray<FName> USCAnimSequence::GetNotifyNames() const {
   TSet<FName> UniqueNames;
@@ -9,3 +247,454 @@ TArray<FName> USCAnimSequence::GetNotifyNames() const {
   }
   return UniqueNames.Array();
 }
+
+const FName USCAnimSequence::NotifyNamesTag(TEXT("SCNotifyNames"));
+
+TArray<FName> USCAnimSequence::ParseNotifyNamesTag(const FString &TagValue) {
+  TArray<FName> Names;
+  if (TagValue.IsEmpty()) {
+    return Names;
+  }
+
+  FString Name;
+  bool bEscaped = false;
+  for (const TCHAR Char : TagValue) {
+    if (bEscaped) {
+      Name.AppendChar(Char);
+      bEscaped = false;
+    } else if (Char == SCAnimSequence::TagEscape) {
+      bEscaped = true;
+    } else if (Char == SCAnimSequence::TagDelimiter) {
+      Names.Add(FName(*Name));
+      Name.Reset();
+    } else {
+      Name.AppendChar(Char);
+    }
+  }
+  Names.Add(FName(*Name));
+  return Names;
+}
+
+float USCAnimSequence::GetReferenceDuration() const {
+  if (DefaultDuration > 0.0f) {
+    return DefaultDuration;
+  }
+
+  float MaxTime = 0.01f;
+  for (const FSCCurveTrack &Track : CurveTracks) {
+    float MinT, MaxT;
+    if (Track.GetTimeRange(MinT, MaxT)) {
+      MaxTime = FMath::Max(MaxTime, MaxT);
+    }
+  }
+  return MaxTime;
+}
+
+void USCAnimSequence::ConvertCurvesToInline() {
+  Modify();
+
+  int32 NumConverted = 0;
+  for (FSCCurveTrack &Track : CurveTracks) {
+    if (Track.ConvertToInline()) {
+      ++NumConverted;
+    }
+  }
+
+  if (NumConverted > 0) {
+    InvalidateEvaluationData();
+  }
+
+  UE_LOG(LogSimpleComp, Log,
+         TEXT("%s: converted %d track(s) to inline curves."), *GetPathName(),
+         NumConverted);
+}
+
+bool USCAnimSequence::EvaluateTrack(int32 TrackIndex, float Time,
+                                    FVector &OutValue) const {
+  if (!CurveTracks.IsValidIndex(TrackIndex)) {
+    return false;
+  }
+
+  const FSCCurveTrack &Track = CurveTracks[TrackIndex];
+  const int32 NumChannels = Track.GetNumChannels();
+  if (NumChannels == 0) {
+    return false;
+  }
+
+  const FSCAnimBakedData *Baked = GetBakedData();
+  const int32 BakedChannel =
+      Baked ? Baked->GetTrackChannel(TrackIndex) : INDEX_NONE;
+  const FSCAnimCompressedData *Compressed = GetCompressedData();
+  const int32 CompressedChannel =
+      Compressed ? Compressed->GetTrackChannel(TrackIndex) : INDEX_NONE;
+
+  for (int32 Channel = 0; Channel < NumChannels; ++Channel) {
+    if (BakedChannel != INDEX_NONE) {
+      OutValue[Channel] = Baked->SampleChannel(BakedChannel + Channel, Time);
+    } else if (CompressedChannel != INDEX_NONE) {
+      OutValue[Channel] =
+          Compressed->SampleChannel(CompressedChannel + Channel, Time);
+    } else {
+      OutValue[Channel] = Track.GetChannelCurve(Channel)->Eval(Time);
+    }
+  }
+  return true;
+}
+
+void USCAnimSequence::BakeSamples() {
+  BakedData.Reset();
+  ++EvaluationVersion;
+
+  if (EvaluationMode != ESCAnimEvaluationMode::Baked) {
+    return;
+  }
+
+  int32 NumSamples;
+  float SampleRate;
+  SCAnimSequence::GetSampleGrid(GetReferenceDuration(), BakeSampleRate,
+                                NumSamples, SampleRate);
+
+  BakedData.SampleRate = SampleRate;
+  BakedData.NumSamples = NumSamples;
+  BakedData.TrackChannels.Init(INDEX_NONE, CurveTracks.Num());
+
+  TArray<float> ChannelSamples;
+  ChannelSamples.SetNumUninitialized(NumSamples);
+  int32 NumBakedChannels = 0;
+
+  for (int32 TrackIndex = 0; TrackIndex < CurveTracks.Num(); ++TrackIndex) {
+    const FSCCurveTrack &Track = CurveTracks[TrackIndex];
+    const int32 NumChannels = Track.GetNumChannels();
+    if (NumChannels == 0) {
+      continue;
+    }
+
+    TArray<float> TrackSamples;
+    TArray<uint16> TrackQuantized;
+    TArray<float> TrackMin;
+    TArray<float> TrackStep;
+    bool bWithinTolerance = true;
+
+    for (int32 Channel = 0; Channel < NumChannels && bWithinTolerance;
+         ++Channel) {
+      const FRichCurve *Curve = Track.GetChannelCurve(Channel);
+
+      float MinValue = TNumericLimits<float>::Max();
+      float MaxValue = TNumericLimits<float>::Lowest();
+      for (int32 Index = 0; Index < NumSamples; ++Index) {
+        const float Value = Curve->Eval(Index / SampleRate);
+        ChannelSamples[Index] = Value;
+        MinValue = FMath::Min(MinValue, Value);
+        MaxValue = FMath::Max(MaxValue, Value);
+      }
+
+      const float Step =
+          (MaxValue - MinValue) / SCAnimSequence::QuantizedRange;
+      if (bQuantizeBakedSamples) {
+        for (int32 Index = 0; Index < NumSamples; ++Index) {
+          const uint16 Quantized =
+              Step > 0.0f ? static_cast<uint16>(FMath::RoundToInt(
+                                (ChannelSamples[Index] - MinValue) / Step))
+                          : 0;
+          TrackQuantized.Add(Quantized);
+          ChannelSamples[Index] = MinValue + Step * Quantized;
+        }
+        TrackMin.Add(MinValue);
+        TrackStep.Add(Step);
+      } else {
+        TrackSamples.Append(ChannelSamples);
+      }
+
+      for (int32 Index = 0; Index < NumSamples - 1 && bWithinTolerance;
+           ++Index) {
+        const float Exact = Curve->Eval((Index + 0.5f) / SampleRate);
+        const float Approx =
+            FMath::Lerp(ChannelSamples[Index], ChannelSamples[Index + 1], 0.5f);
+        bWithinTolerance = FMath::Abs(Exact - Approx) <= BakeErrorTolerance;
+      }
+    }
+
+    if (!bWithinTolerance) {
+      continue;
+    }
+
+    BakedData.TrackChannels[TrackIndex] = NumBakedChannels;
+    NumBakedChannels += NumChannels;
+    BakedData.Samples.Append(TrackSamples);
+    BakedData.QuantizedSamples.Append(TrackQuantized);
+    BakedData.ChannelMin.Append(TrackMin);
+    BakedData.ChannelStep.Append(TrackStep);
+  }
+}
+
+void USCAnimSequence::ClearBakedSamples() {
+  BakedData.Reset();
+  ++EvaluationVersion;
+}
+
+void USCAnimSequence::CompressCurves() {
+  if (HasStrippedCurves()) {
+    return;
+  }
+
+  CompressedData.Reset();
+  CompressionReport = FSCAnimCompressionReport();
+  ++EvaluationVersion;
+
+  if (EvaluationMode != ESCAnimEvaluationMode::Compressed) {
+    return;
+  }
+
+  int32 NumSamples;
+  float SampleRate;
+  SCAnimSequence::GetSampleGrid(GetReferenceDuration(), BakeSampleRate,
+                                NumSamples, SampleRate);
+
+  CompressedData.SampleRate = SampleRate;
+  CompressedData.TrackChannels.Init(INDEX_NONE, CurveTracks.Num());
+  CompressedData.KeyOffsets.Add(0);
+
+  TArray<float> ChannelSamples;
+  ChannelSamples.SetNumUninitialized(NumSamples);
+  TArray<int32> Keys;
+  int32 NumCompressedChannels = 0;
+
+  for (int32 TrackIndex = 0; TrackIndex < CurveTracks.Num(); ++TrackIndex) {
+    const FSCCurveTrack &Track = CurveTracks[TrackIndex];
+    const int32 NumChannels = Track.GetNumChannels();
+    if (NumChannels == 0) {
+      continue;
+    }
+
+    TArray<int32> TrackKeyCounts;
+    TArray<uint16> TrackKeyTimes;
+    TArray<uint16> TrackKeyValues;
+    TArray<float> TrackMin;
+    TArray<float> TrackStep;
+    int32 TrackSourceKeys = 0;
+    bool bWithinTolerance = true;
+
+    for (int32 Channel = 0; Channel < NumChannels && bWithinTolerance;
+         ++Channel) {
+      const FRichCurve *Curve = Track.GetChannelCurve(Channel);
+      TrackSourceKeys += Curve->GetNumKeys();
+
+      float MinValue = TNumericLimits<float>::Max();
+      float MaxValue = TNumericLimits<float>::Lowest();
+      for (int32 Index = 0; Index < NumSamples; ++Index) {
+        const float Value = Curve->Eval(Index / SampleRate);
+        ChannelSamples[Index] = Value;
+        MinValue = FMath::Min(MinValue, Value);
+        MaxValue = FMath::Max(MaxValue, Value);
+      }
+
+      const float Step =
+          (MaxValue - MinValue) / SCAnimSequence::QuantizedRange;
+      SCAnimSequence::ReduceKeys(
+          ChannelSamples, FMath::Max(BakeErrorTolerance - Step * 0.5f, 0.0f),
+          Keys);
+
+      const int32 FirstKey = TrackKeyValues.Num();
+      for (const int32 Key : Keys) {
+        const uint16 Quantized =
+            Step > 0.0f ? static_cast<uint16>(FMath::Clamp(
+                              FMath::RoundToInt(
+                                  (ChannelSamples[Key] - MinValue) / Step),
+                              0, 65535))
+                        : 0;
+        TrackKeyTimes.Add(static_cast<uint16>(Key));
+        TrackKeyValues.Add(Quantized);
+      }
+      TrackKeyCounts.Add(Keys.Num());
+      TrackMin.Add(MinValue);
+      TrackStep.Add(Step);
+
+      for (int32 KeyIndex = 0; KeyIndex < Keys.Num() - 1 && bWithinTolerance;
+           ++KeyIndex) {
+        const float A =
+            MinValue + Step * TrackKeyValues[FirstKey + KeyIndex];
+        const float B =
+            MinValue + Step * TrackKeyValues[FirstKey + KeyIndex + 1];
+        const float Span =
+            static_cast<float>(Keys[KeyIndex + 1] - Keys[KeyIndex]);
+        for (float Offset = 0.0f; Offset < Span && bWithinTolerance;
+             Offset += 0.5f) {
+          const float Exact =
+              Curve->Eval((Keys[KeyIndex] + Offset) / SampleRate);
+          const float Approx = FMath::Lerp(A, B, Offset / Span);
+          bWithinTolerance = FMath::Abs(Exact - Approx) <= BakeErrorTolerance;
+        }
+      }
+    }
+
+    if (!bWithinTolerance) {
+      ++CompressionReport.ExactTracks;
+      continue;
+    }
+
+    CompressedData.TrackChannels[TrackIndex] = NumCompressedChannels;
+    NumCompressedChannels += NumChannels;
+    for (const int32 Count : TrackKeyCounts) {
+      CompressedData.KeyOffsets.Add(CompressedData.KeyOffsets.Last() + Count);
+    }
+    CompressedData.KeyTimes.Append(TrackKeyTimes);
+    CompressedData.KeyValues.Append(TrackKeyValues);
+    CompressedData.ChannelMin.Append(TrackMin);
+    CompressedData.ChannelStep.Append(TrackStep);
+
+    CompressionReport.SourceKeys += TrackSourceKeys;
+    CompressionReport.CompressedKeys += TrackKeyValues.Num();
+  }
+
+  CompressionReport.SourceBytes =
+      CompressionReport.SourceKeys * sizeof(FRichCurveKey);
+  CompressionReport.CompressedBytes = CompressedData.GetDataSize();
+  CompressionReport.SavedBytes =
+      CompressionReport.SourceBytes - CompressionReport.CompressedBytes;
+
+  UE_LOG(LogSimpleComp, Log,
+         TEXT("%s: compressed %d keys (%d bytes) into %d keys (%d bytes), "
+              "saving %d bytes once cooked. %d track(s) kept exact."),
+         *GetPathName(), CompressionReport.SourceKeys,
+         CompressionReport.SourceBytes, CompressionReport.CompressedKeys,
+         CompressionReport.CompressedBytes, CompressionReport.SavedBytes,
+         CompressionReport.ExactTracks);
+}
+
+void USCAnimSequence::ClearCompressedCurves() {
+  if (HasStrippedCurves()) {
+    return;
+  }
+
+  CompressedData.Reset();
+  ++EvaluationVersion;
+}
+
+void USCAnimSequence::EnsureEvaluationData() {
+  if (EvaluationMode == ESCAnimEvaluationMode::Baked && !BakedData.IsValid()) {
+    BakeSamples();
+  } else if (EvaluationMode == ESCAnimEvaluationMode::Compressed &&
+             !CompressedData.IsValid()) {
+    CompressCurves();
+  }
+}
+
+const FSCAnimBakedData *USCAnimSequence::GetBakedData() const {
+  return (EvaluationMode == ESCAnimEvaluationMode::Baked &&
+          BakedData.IsValid())
+             ? &BakedData
+             : nullptr;
+}
+
+const FSCAnimCompressedData *USCAnimSequence::GetCompressedData() const {
+  return (EvaluationMode == ESCAnimEvaluationMode::Compressed &&
+          CompressedData.IsValid())
+             ? &CompressedData
+             : nullptr;
+}
+
+void USCAnimSequence::Serialize(FArchive &Ar) {
+  if (!Ar.IsCooking() || !CompressedData.IsValid()) {
+    Super::Serialize(Ar);
+    return;
+  }
+
+  // Save the compressed tracks without the source curves they replace, then
+  // restore them so the editor keeps the full data.
+  TArray<FSCCurveTrack> SourceTracks = CurveTracks;
+  const float SourceDuration = DefaultDuration;
+  StripCompressedCurves();
+  Super::Serialize(Ar);
+  CurveTracks = MoveTemp(SourceTracks);
+  DefaultDuration = SourceDuration;
+}
+
+void USCAnimSequence::PreSave(FObjectPreSaveContext SaveContext) {
+  Super::PreSave(SaveContext);
+
+  if (SaveContext.IsCooking()) {
+    for (FSCCurveTrack &Track : CurveTracks) {
+      if (!Track.bInlineCurve && !Track.CurveAsset) {
+        Track.SoftCurveAsset.LoadSynchronous();
+      }
+    }
+    BakeSamples();
+    CompressCurves();
+  } else {
+    // Curve assets can be edited without the sequence noticing, so derived
+    // data saved here could go stale. It is rebuilt on cook or first play.
+    InvalidateEvaluationData();
+  }
+}
+
+void USCAnimSequence::GetUnloadedCurves(
+    TArray<FSoftObjectPath> &OutPaths) const {
+  for (const FSCCurveTrack &Track : CurveTracks) {
+    if (!Track.bInlineCurve && !Track.CurveAsset &&
+        !Track.SoftCurveAsset.IsNull() && !Track.SoftCurveAsset.IsValid()) {
+      OutPaths.AddUnique(Track.SoftCurveAsset.ToSoftObjectPath());
+    }
+  }
+}
+
+void USCAnimSequence::NotifyCurvesLoaded() {
+  ++EvaluationVersion;
+}
+
+bool USCAnimSequence::HasStrippedCurves() const {
+  return CurveTracks.ContainsByPredicate([](const FSCCurveTrack &Track) {
+    return Track.StrippedNumChannels > 0;
+  });
+}
+
+void USCAnimSequence::StripCompressedCurves() {
+  DefaultDuration = GetReferenceDuration();
+  for (int32 TrackIndex = 0; TrackIndex < CurveTracks.Num(); ++TrackIndex) {
+    if (CompressedData.GetTrackChannel(TrackIndex) == INDEX_NONE) {
+      continue;
+    }
+
+    FSCCurveTrack &Track = CurveTracks[TrackIndex];
+    Track.StrippedNumChannels = Track.GetNumChannels();
+    Track.CurveAsset = nullptr;
+    Track.SoftCurveAsset.Reset();
+    Track.InlineFloatCurve = FRuntimeFloatCurve();
+    Track.InlineVectorCurve = FRuntimeVectorCurve();
+  }
+}
+
+void USCAnimSequence::GetAssetRegistryTags(
+    FAssetRegistryTagsContext Context) const {
+  Super::GetAssetRegistryTags(Context);
+
+  TArray<FName> Names = GetNotifyNames();
+  Names.Sort(FNameLexicalLess());
+  FString Value;
+  for (const FName &Name : Names) {
+    if (!Value.IsEmpty()) {
+      Value.AppendChar(SCAnimSequence::TagDelimiter);
+    }
+    for (const TCHAR Char : Name.ToString()) {
+      if (Char == SCAnimSequence::TagDelimiter ||
+          Char == SCAnimSequence::TagEscape) {
+        Value.AppendChar(SCAnimSequence::TagEscape);
+      }
+      Value.AppendChar(Char);
+    }
+  }
+  Context.AddTag(
+      FAssetRegistryTag(NotifyNamesTag, Value, FAssetRegistryTag::TT_Hidden));
+}
+
+#if WITH_EDITOR
+void USCAnimSequence::PostEditChangeProperty(
+    FPropertyChangedEvent &PropertyChangedEvent) {
+  Super::PostEditChangeProperty(PropertyChangedEvent);
+  InvalidateEvaluationData();
+}
+#endif
+
+void USCAnimSequence::InvalidateEvaluationData() {
+  ClearBakedSamples();
+  ClearCompressedCurves();
+}
@@ -1,11 +1,111 @@
 #include "Components/Animation/SCCurveAnimComponent.h"
+#include "Components/Animation/SCAnimEvalCache.h"
+#include "Components/Animation/SCAnimPlaylist.h"
 #include "Components/Animation/SCAnimSequence.h"
-#include "Curves/CurveFloat.h"
-#include "Curves/CurveVector.h"
+#include "Components/Animation/SCCurveAnimSubsystem.h"
+#include "Components/PrimitiveComponent.h"
+#include "Engine/AssetManager.h"
+#include "Engine/StreamableManager.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+#include "Physics/PhysicsInterfaceCore.h"
+#include "PhysicsEngine/BodyInstance.h"
+
+uint32 USCCurveAnimComponent::ExternalEvaluationSerial = 1;
+
+namespace SCCurveAnim {
+/** Limits how many playlist entries one update can run through. The entry
+ * reached at the limit starts without being advanced, and plays from the
+ * next update. */
+constexpr int32 MaxPlaylistChainDepth = 16;
+
+/** Returns the world transform a relative transform of the component
+ * resolves to under its current attach parent. */
+FTransform ToWorld(const USceneComponent &Component,
+                   const FTransform &Relative) {
+  const USceneComponent *Parent = Component.GetAttachParent();
+  return Parent ? Relative * Parent->GetSocketTransform(
+                                 Component.GetAttachSocketName())
+                : Relative;
+}
+
+/** Returns true if the primitive has a body that is not simulated. */
+bool HasKinematicBody(const UPrimitiveComponent &Primitive) {
+  const FBodyInstance *Body = Primitive.GetBodyInstance();
+  return Body && Body->IsValidBodyInstance() &&
+         !Body->IsInstanceSimulatingPhysics();
+}
+
+/** Sends a world transform to physics as the kinematic target of the
+ * primitive's body.
+ * @return False if the primitive has no kinematic body. */
+bool SetKinematicTarget(UPrimitiveComponent &Primitive,
+                        const FTransform &WorldTarget) {
+  if (!HasKinematicBody(Primitive)) {
+    return false;
+  }
+
+  FBodyInstance *Body = Primitive.GetBodyInstance();
+
+  Body->bUpdateKinematicFromSimulation = true;
+  FPhysicsCommand::ExecuteWrite(
+      Body->GetPhysicsActorHandle(),
+      [&WorldTarget](const FPhysicsActorHandle &Actor) {
+        FPhysicsInterface::SetKinematicTarget_AssumesLocked(Actor,
+                                                            WorldTarget);
+      });
+  return true;
+}
+
+/** Writes custom data values sorted by slot, in runs of up to four adjacent
+ * slots, skipping runs whose values are unchanged. */
+void WriteCustomPrimitiveData(UPrimitiveComponent &Primitive,
+                              TArrayView<const FSCAnimCustomOp> Ops,
+                              TArrayView<const float> Values) {
+  int32 Index = 0;
+  while (Index < Ops.Num()) {
+    const int32 DataIndex = Ops[Index].DataIndex;
+    int32 Num = 1;
+    while (Num < 4 && Index + Num < Ops.Num() &&
+           Ops[Index + Num].DataIndex == DataIndex + Num) {
+      ++Num;
+    }
+
+    const TArray<float> &Current = Primitive.GetCustomPrimitiveData().Data;
+    bool bChanged = false;
+    for (int32 Offset = 0; Offset < Num; ++Offset) {
+      bChanged |= !Current.IsValidIndex(DataIndex + Offset) ||
+                  Current[DataIndex + Offset] != Values[Index + Offset];
+    }
+
+    if (bChanged) {
+      const float *Run = &Values[Index];
+      switch (Num) {
+      case 1:
+        Primitive.SetCustomPrimitiveDataFloat(DataIndex, Run[0]);
+        break;
+      case 2:
+        Primitive.SetCustomPrimitiveDataVector2(DataIndex,
+                                                FVector2D(Run[0], Run[1]));
+        break;
+      case 3:
+        Primitive.SetCustomPrimitiveDataVector3(
+            DataIndex, FVector(Run[0], Run[1], Run[2]));
+        break;
+      default:
+        Primitive.SetCustomPrimitiveDataVector4(
+            DataIndex, FVector4(Run[0], Run[1], Run[2], Run[3]));
+        break;
+      }
+    }
+    Index += Num;
+  }
+}
+} // namespace SCCurveAnim
 
 USCCurveAnimComponent::USCCurveAnimComponent() {
   PrimaryComponentTick.bCanEverTick = true;
-  PrimaryComponentTick.bStartWithTickEnabled = true;
+  PrimaryComponentTick.bStartWithTickEnabled = false;
 
   InitialLocation = FVector::ZeroVector;
   InitialRotation = FRotator::ZeroRotator;
@@ -19,37 +119,180 @@ void USCCurveAnimComponent::BeginPlay() {
   InitialRotation = GetRelativeRotation();
   InitialScale = GetRelativeScale3D();
 
-  if (bAutoPlay && AnimSequence) {
+  if (bAutoPlay && (AnimSequence || !SoftAnimSequence.IsNull())) {
     Play();
   }
 }
 
+void USCCurveAnimComponent::EndPlay(const EEndPlayReason::Type EndPlayReason) {
+  CancelPendingPlay();
+  ClearPlaylist();
+  ReleaseActiveHandle(true);
+  ReleasePreloadedSequences();
+  ReleaseKinematicChildren();
+  BoundTargetBases.Reset();
+
+  if (bUseBatchedEvaluation) {
+    if (USCCurveAnimSubsystem *Subsystem =
+            GetWorld()->GetSubsystem<USCCurveAnimSubsystem>()) {
+      Subsystem->Unregister(this);
+    }
+  }
+
+  Super::EndPlay(EndPlayReason);
+}
+
 void USCCurveAnimComponent::TickComponent(
     float DeltaTime, ELevelTick TickType,
     FActorComponentTickFunction *ThisTickFunction) {
   Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
 
+  const float StepTime =
+      SignificanceState.Update(*this, Significance, DeltaTime);
   if (bIsPlaying) {
-    UpdateAnimation(DeltaTime);
+    UpdateAnimation(StepTime);
   }
 }
 
 void USCCurveAnimComponent::Play() {
+  if (!AnimSequence && !SoftAnimSequence.IsNull()) {
+    PlaySoft(SoftAnimSequence, PlaybackDuration, true, false, bLoop);
+    return;
+  }
   PlayEx(nullptr, PlaybackDuration, true, false, bLoop);
 }
 
 void USCCurveAnimComponent::PlayEx(USCAnimSequence *Sequence, float Duration,
                                    bool bFromStart, bool bReverse,
                                    bool bInLoop) {
-  if (Sequence) {
-    AnimSequence = Sequence;
+  CancelPendingPlay();
+  ClearPlaylist();
+  ReleaseActiveHandle(true);
+
+  USCAnimSequence *Target = Sequence ? Sequence : AnimSequence.Get();
+  if (!Target) {
+    return;
+  }
+
+  TArray<FSoftObjectPath> UnloadedCurves;
+  Target->GetUnloadedCurves(UnloadedCurves);
+  if (UnloadedCurves.Num() > 0) {
+    PendingPlay = {Target, Duration, bFromStart, bReverse, bInLoop, true};
+    StartAsyncLoad(PendingPlayHandle, UnloadedCurves,
+                   &USCCurveAnimComponent::OnPendingPlayLoaded);
+    return;
   }
 
-  if (!AnimSequence) {
+  StartPlayback(Target, Duration, bFromStart, bReverse, bInLoop);
+}
+
+void USCCurveAnimComponent::PlaySoft(TSoftObjectPtr<USCAnimSequence> Sequence,
+                                     float Duration, bool bFromStart,
+                                     bool bReverse, bool bInLoop) {
+  if (USCAnimSequence *Loaded = Sequence.Get()) {
+    PlayEx(Loaded, Duration, bFromStart, bReverse, bInLoop);
     return;
   }
 
-  PlaybackDuration = (Duration > 0.0f) ? Duration : GetEffectiveDuration();
+  CancelPendingPlay();
+  ClearPlaylist();
+  ReleaseActiveHandle(true);
+  if (Sequence.IsNull()) {
+    return;
+  }
+
+  PendingPlay = {Sequence, Duration, bFromStart, bReverse, bInLoop, false};
+  StartAsyncLoad(PendingPlayHandle, {Sequence.ToSoftObjectPath()},
+                 &USCCurveAnimComponent::OnPendingPlayLoaded);
+}
+
+FSCAnimHandle USCCurveAnimComponent::PlayWithHandle(USCAnimSequence *Sequence,
+                                                    float Duration,
+                                                    bool bFromStart,
+                                                    bool bReverse,
+                                                    bool bInLoop) {
+  PlayEx(Sequence, Duration, bFromStart, bReverse, bInLoop);
+  if (!bIsPlaying && !IsPlaybackPending()) {
+    return FSCAnimHandle();
+  }
+
+  ActiveHandleSlot = AcquireHandleSlot();
+  return MakeHandle(ActiveHandleSlot);
+}
+
+bool USCCurveAnimComponent::IsHandleActive(const FSCAnimHandle &Handle) const {
+  return Handle.IsSet() && HandleSlots.IsValidIndex(Handle.Slot) &&
+         HandleSlots[Handle.Slot].Generation == Handle.Generation;
+}
+
+void USCCurveAnimComponent::StopHandle(const FSCAnimHandle &Handle) {
+  if (IsHandleActive(Handle)) {
+    Stop();
+  }
+}
+
+void USCCurveAnimComponent::PauseHandle(const FSCAnimHandle &Handle) {
+  if (IsHandleActive(Handle)) {
+    Pause();
+  }
+}
+
+void USCCurveAnimComponent::ResumeHandle(const FSCAnimHandle &Handle) {
+  if (IsHandleActive(Handle)) {
+    Resume();
+  }
+}
+
+FSCAnimHandleDelegates *
+USCCurveAnimComponent::GetHandleDelegates(const FSCAnimHandle &Handle) {
+  return IsHandleActive(Handle) ? &HandleSlots[Handle.Slot].Delegates
+                                : nullptr;
+}
+
+bool USCCurveAnimComponent::IsPlaybackPending() const {
+  return PendingPlayHandle.IsValid() &&
+         PendingPlayHandle->IsLoadingInProgress();
+}
+
+void USCCurveAnimComponent::PreloadSequences(
+    const TArray<TSoftObjectPtr<USCAnimSequence>> &Sequences) {
+  ReleasePreloadedSequences();
+
+  TArray<FSoftObjectPath> Paths;
+  for (const TSoftObjectPtr<USCAnimSequence> &Sequence : Sequences) {
+    if (!Sequence.IsNull()) {
+      PreloadedSequences.Add(Sequence);
+      Paths.AddUnique(Sequence.ToSoftObjectPath());
+    }
+  }
+
+  if (Paths.Num() == 0) {
+    OnSequencesPreloaded.Broadcast();
+    return;
+  }
+  StartAsyncLoad(PreloadHandle, Paths, &USCCurveAnimComponent::OnPreloadLoaded);
+}
+
+void USCCurveAnimComponent::ReleasePreloadedSequences() {
+  if (PreloadHandle.IsValid()) {
+    PreloadHandle->CancelHandle();
+    PreloadHandle.Reset();
+  }
+  if (PreloadCurvesHandle.IsValid()) {
+    PreloadCurvesHandle->CancelHandle();
+    PreloadCurvesHandle.Reset();
+  }
+  PreloadedSequences.Reset();
+}
+
+void USCCurveAnimComponent::StartPlayback(USCAnimSequence *Sequence,
+                                          float Duration, bool bFromStart,
+                                          bool bReverse, bool bInLoop) {
+  AnimSequence = Sequence;
+  RefreshEvalPlan();
+
+  PlaybackDuration =
+      (Duration > 0.0f) ? Duration : EvalPlan.GetReferenceDuration();
   bIsPlaying = true;
   bIsPaused = false;
   bFinished = false;
@@ -59,22 +302,53 @@ void USCCurveAnimComponent::PlayEx(USCAnimSequence *Sequence, float Duration,
   if (bFromStart) {
     PlaybackCurrentTime = bReversePlayback ? PlaybackDuration : 0.0f;
     CurrentTime = PlaybackCurrentTime;
-    FiredNotifyIndices.Empty();
   }
+  ResetNotifyCursor(true);
+
+  UpdateTickState();
 }
 
-void USCCurveAnimComponent::PlayFromStart() {
-  PlayEx(nullptr, PlaybackDuration, true, false, bLoop);
+void USCCurveAnimComponent::PlayPlaylist(USCAnimPlaylist *Playlist) {
+  CancelPendingPlay();
+  ClearPlaylist();
+  ReleaseActiveHandle(true);
+
+  const int32 NumPlayable = Playlist ? Playlist->GetNumPlayableEntries() : 0;
+  if (NumPlayable == 0) {
+    return;
+  }
+
+  ActivePlaylist = Playlist;
+  PlaylistPicksLeft =
+      Playlist->LoopCount > 0 ? Playlist->LoopCount * NumPlayable : -1;
+  PlaylistRandom.GenerateNewSeed();
+  PlaylistPlans.SetNum(Playlist->Entries.Num());
+  StartPlaylistEntry(PickPlaylistEntry());
 }
 
+void USCCurveAnimComponent::PlayFromStart() { Play(); }
+
 void USCCurveAnimComponent::Stop() {
+  CancelPendingPlay();
+  ClearPlaylist();
   bIsPlaying = false;
   bIsPaused = false;
+  ResetNotifyCursor(false);
+  // Lets streamed curves the plan kept loaded go; the next play rebuilds it
+  EvalPlan.Reset();
+  UpdateTickState();
+  ReleaseActiveHandle(true);
 }
 
-void USCCurveAnimComponent::Pause() { bIsPaused = true; }
+void USCCurveAnimComponent::Pause() {
+  bIsPaused = true;
+  UpdateTickState();
+}
 
-void USCCurveAnimComponent::Resume() { bIsPaused = false; }
+void USCCurveAnimComponent::Resume() {
+  bIsPaused = false;
+  UpdateTickState();
+}
 
 void USCCurveAnimComponent::ReverseFromEnd() {
   PlayEx(nullptr, PlaybackDuration, true, true, bLoop);
@@ -84,224 +358,630 @@ void USCCurveAnimComponent::ReverseFromCurrent() {
   bReversePlayback = !bReversePlayback;
   bIsPlaying = true;
   bIsPaused = false;
+  // Notifies behind the playback position lie ahead of it again.
+  ResetNotifyCursor(true);
+  UpdateTickState();
 }
 
 void USCCurveAnimComponent::SetPlaybackPosition(float NewTime) {
   PlaybackCurrentTime = FMath::Clamp(NewTime, 0.0f, PlaybackDuration);
   CurrentTime = PlaybackCurrentTime;
+  ResetNotifyCursor(false);
   UpdateAnimation(0.0f);
+  UpdateTickState();
 }
 
-float USCCurveAnimComponent::GetEffectiveDuration() const {
-  if (AnimSequence && AnimSequence->DefaultDuration > 0.0f) {
-    return AnimSequence->DefaultDuration;
+void USCCurveAnimComponent::StartAsyncLoad(
+    TSharedPtr<FStreamableHandle> &OutHandle,
+    const TArray<FSoftObjectPath> &Paths,
+    void (USCCurveAnimComponent::*Callback)()) {
+  const TSharedPtr<FStreamableHandle> Handle =
+      UAssetManager::GetStreamableManager().RequestAsyncLoad(
+          Paths, FStreamableDelegate::CreateUObject(this, Callback),
+          FStreamableManager::DefaultAsyncLoadPriority, false, true);
+  OutHandle = Handle;
+  if (Handle.IsValid()) {
+    Handle->StartStalledHandle();
   }
+}
 
-  float MaxTime = 0.01f;
-  if (AnimSequence) {
-    for (const FSCCurveTrack &Track : AnimSequence->CurveTracks) {
-      if (Track.CurveAsset) {
-        float MinT, MaxT;
-        Track.CurveAsset->GetTimeRange(MinT, MaxT);
-        MaxTime = FMath::Max(MaxTime, MaxT);
+void USCCurveAnimComponent::OnPendingPlayLoaded() {
+  PendingPlayHandle.Reset();
+
+  USCAnimSequence *Sequence = PendingPlay.Sequence.Get();
+  if (!Sequence) {
+    ReleaseActiveHandle(true);
+    return;
+  }
+
+  if (!PendingPlay.bCurvesRequested) {
+    TArray<FSoftObjectPath> UnloadedCurves;
+    Sequence->GetUnloadedCurves(UnloadedCurves);
+    if (UnloadedCurves.Num() > 0) {
+      PendingPlay.bCurvesRequested = true;
+      StartAsyncLoad(PendingPlayHandle, UnloadedCurves,
+                     &USCCurveAnimComponent::OnPendingPlayLoaded);
+      return;
+    }
+  } else {
+    Sequence->NotifyCurvesLoaded();
+  }
+
+  StartPlayback(Sequence, PendingPlay.Duration, PendingPlay.bFromStart,
+                PendingPlay.bReverse, PendingPlay.bLoop);
+}
+
+void USCCurveAnimComponent::CancelPendingPlay() {
+  if (PendingPlayHandle.IsValid()) {
+    PendingPlayHandle->CancelHandle();
+    PendingPlayHandle.Reset();
+  }
+  PendingPlay = FPendingPlay();
+}
+
+void USCCurveAnimComponent::OnPreloadLoaded() {
+  TArray<FSoftObjectPath> UnloadedCurves;
+  for (const TSoftObjectPtr<USCAnimSequence> &Sequence : PreloadedSequences) {
+    if (const USCAnimSequence *Loaded = Sequence.Get()) {
+      Loaded->GetUnloadedCurves(UnloadedCurves);
+    }
+  }
+
+  if (UnloadedCurves.Num() > 0 && !PreloadCurvesHandle.IsValid()) {
+    StartAsyncLoad(PreloadCurvesHandle, UnloadedCurves,
+                   &USCCurveAnimComponent::OnPreloadLoaded);
+    return;
+  }
+
+  if (PreloadCurvesHandle.IsValid()) {
+    for (const TSoftObjectPtr<USCAnimSequence> &Sequence : PreloadedSequences) {
+      if (USCAnimSequence *Loaded = Sequence.Get()) {
+        Loaded->NotifyCurvesLoaded();
       }
     }
   }
-  return MaxTime;
+  OnSequencesPreloaded.Broadcast();
 }
 
-void USCCurveAnimComponent::UpdateAnimation(float DeltaTime) {
-  if (bIsPaused || PlaybackDuration <= 0.0f) {
+bool USCCurveAnimComponent::HasNextPlaylistEntry() const {
+  return ActivePlaylist &&
+         (PlaylistEntryLoopsLeft > 1 || PlaylistPicksLeft != 0);
+}
+
+void USCCurveAnimComponent::ContinuePlaylist(float Excess) {
+  int32 EntryIndex = PlaylistEntry;
+  if (PlaylistEntryLoopsLeft > 1) {
+    --PlaylistEntryLoopsLeft;
+  } else {
+    EntryIndex = PickPlaylistEntry();
+  }
+  StartPlaylistEntry(EntryIndex);
+  if (PlaylistChainDepth >= SCCurveAnim::MaxPlaylistChainDepth) {
     return;
   }
 
-  float PrevTime = PlaybackCurrentTime;
-  float Direction = bReversePlayback ? -1.0f : 1.0f;
-  PlaybackCurrentTime += DeltaTime * PlayRate * Direction;
+  ++PlaylistChainDepth;
+  const FSCAnimPlaybackStep Step = SCAnimPlayback::Advance(
+      PlaybackCurrentTime, Excess, 1.0f, 1.0f, PlaybackDuration, false);
+  const float ReferenceScale =
+      EvalPlan.GetReferenceDuration() / PlaybackDuration;
+  FSCAnimChannelValues Values;
+  EvalPlan.Evaluate(Step.Time * ReferenceScale, Values);
+  CommitStep(Step, ReferenceScale, Values);
+  --PlaylistChainDepth;
+
+  if (PlaylistChainDepth == 0) {
+    UpdateTickState();
+  }
+}
 
-  bFinished = false;
-  if (!bReversePlayback && PlaybackCurrentTime >= PlaybackDuration) {
-    if (bLoop) {
-      PlaybackCurrentTime -= PlaybackDuration;
-      FiredNotifyIndices.Empty();
-    } else {
-      PlaybackCurrentTime = PlaybackDuration;
-      bFinished = true;
+int32 USCCurveAnimComponent::PickPlaylistEntry() {
+  const int32 EntryIndex =
+      ActivePlaylist->PickEntry(PlaylistEntry, PlaylistRandom);
+  if (PlaylistPicksLeft > 0) {
+    --PlaylistPicksLeft;
+  }
+  PlaylistEntryLoopsLeft =
+      FMath::Max(ActivePlaylist->Entries[EntryIndex].LoopCount, 1);
+  return EntryIndex;
+}
+
+void USCCurveAnimComponent::StartPlaylistEntry(int32 EntryIndex) {
+  if (EntryIndex != PlaylistEntry) {
+    if (PlaylistEntry != INDEX_NONE) {
+      Swap(EvalPlan, PlaylistPlans[PlaylistEntry]);
     }
-  } else if (bReversePlayback && PlaybackCurrentTime <= 0.0f) {
-    if (bLoop) {
-      PlaybackCurrentTime += PlaybackDuration;
-      FiredNotifyIndices.Empty();
-    } else {
-      PlaybackCurrentTime = 0.0f;
-      bFinished = true;
+    Swap(EvalPlan, PlaylistPlans[EntryIndex]);
+    PlaylistEntry = EntryIndex;
+
+    const FSCAnimPlaylistEntry &Entry = ActivePlaylist->Entries[EntryIndex];
+    if (EvalPlan.IsBuiltFor(Entry.Sequence) &&
+        (BoundTargets.Num() > 0 || EvalPlan.GetBoundTargets().Num() > 0)) {
+      ResolveBoundTargets();
     }
   }
 
-  CurrentTime = PlaybackCurrentTime;
+  const FSCAnimPlaylistEntry &Entry = ActivePlaylist->Entries[EntryIndex];
+  StartPlayback(Entry.Sequence, Entry.Duration, true, false, false);
+}
 
-  ApplyTransform();
+void USCCurveAnimComponent::ClearPlaylist() {
+  ActivePlaylist = nullptr;
+  PlaylistEntry = INDEX_NONE;
+  PlaylistEntryLoopsLeft = 0;
+  PlaylistPicksLeft = 0;
+  PlaylistPlans.Reset();
+}
 
-  ProcessNotifies(PrevTime, PlaybackCurrentTime);
+int32 USCCurveAnimComponent::AcquireHandleSlot() {
+  int32 SlotIndex = HandleSlots.IndexOfByPredicate(
+      [](const FHandleSlot &Slot) { return Slot.Generation == 0; });
+  if (SlotIndex == INDEX_NONE) {
+    SlotIndex = HandleSlots.AddDefaulted();
+  }
 
-  float NormalizedTime =
-      PlaybackDuration > 0.0f ? PlaybackCurrentTime / PlaybackDuration : 0.0f;
+  if (++NextHandleGeneration == 0) {
+    ++NextHandleGeneration;
+  }
+  HandleSlots[SlotIndex].Generation = NextHandleGeneration;
+  return SlotIndex;
+}
 
-  // Calculate Reference Time (time within the original animation asset)
-  // If we are time-stretching, we map PlaybackCurrentTime (0..PlaybackDuration)
-  // to ReferenceTime (0..EffectiveDuration)
-  float EffectiveDuration = GetEffectiveDuration();
-  float ReferenceTime = NormalizedTime * EffectiveDuration;
-  float PrevReferenceTime =
-      (PlaybackDuration > 0.0f)
-          ? (PrevTime / PlaybackDuration) * EffectiveDuration
-          : 0.0f;
+void USCCurveAnimComponent::ReleaseActiveHandle(bool bInterrupted) {
+  if (ActiveHandleSlot == INDEX_NONE) {
+    return;
+  }
 
-  CurrentTime = ReferenceTime;
+  const FSCAnimHandle Handle = MakeHandle(ActiveHandleSlot);
+  FHandleSlot &Slot = HandleSlots[ActiveHandleSlot];
+  const FSCAnimHandleFinishedDelegate OnFinished =
+      MoveTemp(Slot.Delegates.OnFinished);
+  Slot = FHandleSlot();
+  ActiveHandleSlot = INDEX_NONE;
 
-  ApplyTransform(ReferenceTime);
+  OnFinished.ExecuteIfBound(Handle, bInterrupted);
+}
 
-  ProcessNotifies(PrevReferenceTime, ReferenceTime);
+FSCAnimHandle USCCurveAnimComponent::MakeHandle(int32 SlotIndex) const {
+  FSCAnimHandle Handle;
+  Handle.Slot = SlotIndex;
+  Handle.Generation = HandleSlots[SlotIndex].Generation;
+  return Handle;
+}
 
-  OnAnimationUpdate.Broadcast(PlaybackCurrentTime, NormalizedTime);
+void USCCurveAnimComponent::RefreshEvalPlan() {
+  if (AnimSequence) {
+    AnimSequence->EnsureEvaluationData();
+  }
+  if (!EvalPlan.IsBuiltFor(AnimSequence)) {
+    EvalPlan.Build(AnimSequence);
+    ResolveBoundTargets();
+  }
+}
+
+void USCCurveAnimComponent::ResolveBoundTargets() {
+  const TArray<FSCAnimPlanTarget> &PlanTargets = EvalPlan.GetBoundTargets();
+  TArray<FBoundTarget> Resolved;
+  Resolved.Reserve(PlanTargets.Num());
+
+  TInlineComponentArray<USceneComponent *> Components(GetOwner());
+  for (const FSCAnimPlanTarget &PlanTarget : PlanTargets) {
+    USceneComponent *const *Found =
+        Components.FindByPredicate([this, &PlanTarget](
+                                       const USceneComponent *Component) {
+          const FName Name = PlanTarget.Type == ESCAnimTargetType::Socket
+                                 ? Component->GetAttachSocketName()
+                                 : Component->GetFName();
+          return Component != this && Name == PlanTarget.Name;
+        });
+
+    FBoundTarget &Target = Resolved.AddDefaulted_GetRef();
+    if (!Found) {
+      continue;
+    }
+
+    Target.Component = *Found;
+    const FTransform *Base = BoundTargetBases.Find(Target.Component);
+    Target.Base =
+        Base ? *Base
+             : BoundTargetBases.Add(Target.Component,
+                                    (*Found)->GetRelativeTransform());
+  }
+
+  BoundTargets = MoveTemp(Resolved);
+  BoundValues.SetNumUninitialized(BoundTargets.Num());
+}
 
-  if (bFinished) {
+void USCCurveAnimComponent::UpdateAnimation(float DeltaTime) {
+  if (bIsPaused || PlaybackDuration <= 0.0f) {
+    return;
+  }
+
+  RefreshEvalPlan();
+
+  const FSCAnimPlaybackStep Step = SCAnimPlayback::Advance(
+      PlaybackCurrentTime, DeltaTime, PlayRate,
+      bReversePlayback ? -1.0f : 1.0f, PlaybackDuration, bLoop);
+  const float ReferenceScale =
+      EvalPlan.GetReferenceDuration() / PlaybackDuration;
+
+  FSCAnimChannelValues Values;
+  if (bUseSharedEvaluationCache) {
+    Values = FSCAnimEvalCache::Evaluate(EvalPlan, Step.Time * ReferenceScale);
+  } else {
+    EvalPlan.Evaluate(Step.Time * ReferenceScale, Values);
+  }
+
+  CommitStep(Step, ReferenceScale, Values);
+}
+
+void USCCurveAnimComponent::CommitStep(const FSCAnimPlaybackStep &Step,
+                                       float ReferenceScale,
+                                       const FSCAnimChannelValues &Values) {
+  const uint32 Serial = PlaybackSerial;
+  PlaybackCurrentTime = Step.Time;
+  bFinished = Step.bFinished;
+  CurrentTime = PlaybackCurrentTime * ReferenceScale;
+
+  const bool bChains =
+      bFinished && !bReversePlayback && HasNextPlaylistEntry();
+  if (!bChains) {
+    ApplyTransform(Values);
+  }
+
+  ProcessNotifies(Step, ReferenceScale);
+
+  if (bChains && PlaybackSerial == Serial) {
+    ContinuePlaylist(Step.Excess);
+    return;
+  }
+
+  BroadcastUpdate();
+
+  if (bFinished && PlaybackSerial == Serial) {
+    ClearPlaylist();
     bIsPlaying = false;
+    EvalPlan.Reset();
+    UpdateTickState();
+    ReleaseActiveHandle(false);
+    OnAnimationFinishedNative.Broadcast();
     OnAnimationFinished.Broadcast();
   }
 }
 
-void USCCurveAnimComponent::ApplyTransform() {
-  // Overload for internal use without arguments if needed,
-  // but better to refactor checking call sites.
-  // For now, let's keep the signature compatible or update usage.
-  // The previous code used member vars, but we need to pass ReferenceTime.
-  // Let's update the signature in header next if needed, or use a member var.
-  // Since CurrentTime is now updated to ReferenceTime above, we can use
-  // CurrentTime!
-  ApplyTransform(CurrentTime);
+void USCCurveAnimComponent::BroadcastUpdate() {
+  const bool bHandleBound =
+      ActiveHandleSlot != INDEX_NONE &&
+      HandleSlots[ActiveHandleSlot].Delegates.OnUpdate.IsBound();
+  if (!bHandleBound && !OnAnimationUpdateNative.IsBound() &&
+      !OnAnimationUpdate.IsBound()) {
+    return;
+  }
+
+  const float Time = PlaybackCurrentTime;
+  const float NormalizedTime = Time / PlaybackDuration;
+  if (bHandleBound) {
+    const FSCAnimHandleUpdateDelegate Delegate =
+        HandleSlots[ActiveHandleSlot].Delegates.OnUpdate;
+    Delegate.Execute(MakeHandle(ActiveHandleSlot), Time, NormalizedTime);
+  }
+  OnAnimationUpdateNative.Broadcast(Time, NormalizedTime);
+  OnAnimationUpdate.Broadcast(Time, NormalizedTime);
 }
 
-void USCCurveAnimComponent::ApplyTransform(float SampleTime) {
-  if (!AnimSequence) {
+void USCCurveAnimComponent::ApplyTransform(
+    const FSCAnimChannelValues &Values) {
+  if (!EvalPlan.GetSequence()) {
     return;
   }
 
-  // NormalizedTime was used before, but curve sampling usually expects absolute
-  // time unless the curve is explicitly 0..1. Standard UCurveFloat expects
-  // time. If we assume curves are authored in seconds, we should use SampleTime
-  // (ReferenceTime).
+  if (BoundTargets.Num() == 0) {
+    SetAnimatedTransform(EvalPlan.Compose(Values, InitialLocation,
+                                         InitialRotation, InitialScale));
+  } else {
+    FScopedMovementUpdate DeferredUpdate(this,
+                                         EScopedUpdate::DeferredUpdates);
+    SetAnimatedTransform(EvalPlan.Compose(Values, InitialLocation,
+                                         InitialRotation, InitialScale));
+    ApplyBoundTargets();
+  }
 
-  FVector NewLoc = InitialLocation;
-  FRotator NewRot = InitialRotation;
-  FVector NewScale = InitialScale;
+  if (EvalPlan.GetCustomOps().Num() > 0) {
+    ApplyCustomData();
+  }
+}
 
-  for (const FSCCurveTrack &Track : AnimSequence->CurveTracks) {
-    if (UCurveFloat *Curve = Cast<UCurveFloat>(Track.CurveAsset)) {
-      float Value = Curve->GetFloatValue(SampleTime) * Track.ScaleFloat;
+void USCCurveAnimComponent::ApplyBoundTargets() {
+  EvalPlan.EvaluateBound(CurrentTime, BoundValues);
+  const TArray<FSCAnimPlanTarget> &PlanTargets = EvalPlan.GetBoundTargets();
+  for (int32 Index = 0; Index < BoundTargets.Num(); ++Index) {
+    USceneComponent *Component = BoundTargets[Index].Component.Get();
+    if (!Component || PlanTargets[Index].WriteMask == 0) {
+      continue;
+    }
 
-      switch (Track.TrackType) {
-      case ESCCurveTrackType::LocationX:
-        NewLoc.X = Track.bAddBaseValue ? InitialLocation.X + Value : Value;
-        break;
-      case ESCCurveTrackType::LocationY:
-        NewLoc.Y = Track.bAddBaseValue ? InitialLocation.Y + Value : Value;
-        break;
-      case ESCCurveTrackType::LocationZ:
-        NewLoc.Z = Track.bAddBaseValue ? InitialLocation.Z + Value : Value;
-        break;
-      case ESCCurveTrackType::RotationP:
-        NewRot.Pitch =
-            Track.bAddBaseValue ? InitialRotation.Pitch + Value : Value;
-        break;
-      case ESCCurveTrackType::RotationY:
-        NewRot.Yaw = Track.bAddBaseValue ? InitialRotation.Yaw + Value : Value;
-        break;
-      case ESCCurveTrackType::RotationR:
-        NewRot.Roll =
-            Track.bAddBaseValue ? InitialRotation.Roll + Value : Value;
-        break;
-      case ESCCurveTrackType::ScaleX:
-        NewScale.X = Track.bAddBaseValue ? InitialScale.X + Value : Value;
-        break;
-      case ESCCurveTrackType::ScaleY:
-        NewScale.Y = Track.bAddBaseValue ? InitialScale.Y + Value : Value;
-        break;
-      case ESCCurveTrackType::ScaleZ:
-        NewScale.Z = Track.bAddBaseValue ? InitialScale.Z + Value : Value;
-        break;
-      default:
-        break;
-      }
-    } else if (UCurveVector *VectorCurve =
-                   Cast<UCurveVector>(Track.CurveAsset)) {
-      FVector Value =
-          VectorCurve->GetVectorValue(SampleTime) * Track.ScaleVector;
-
-      switch (Track.TrackType) {
-      case ESCCurveTrackType::VectorLocation:
-        NewLoc = Track.bAddBaseValue ? InitialLocation + Value : Value;
-        break;
-      case ESCCurveTrackType::VectorRotation:
-        // Mapping Vector X->Pitch, Y->Yaw, Z->Roll to match generic 3D vector
-        // to rotator
-        if (Track.bAddBaseValue) {
-          NewRot.Pitch = InitialRotation.Pitch + Value.X;
-          NewRot.Yaw = InitialRotation.Yaw + Value.Y;
-          NewRot.Roll = InitialRotation.Roll + Value.Z;
-        } else {
-          NewRot.Pitch = Value.X;
-          NewRot.Yaw = Value.Y;
-          NewRot.Roll = Value.Z;
+    const FTransform Relative = EvalPlan.ComposeBound(
+        Index, BoundValues[Index], BoundTargets[Index].Base);
+    UPrimitiveComponent *Primitive = Cast<UPrimitiveComponent>(Component);
+    if (!bUseKinematicTarget || !Primitive ||
+        !SCCurveAnim::SetKinematicTarget(
+            *Primitive, SCCurveAnim::ToWorld(*Component, Relative))) {
+      Component->SetRelativeTransform(Relative);
+    }
+  }
+}
+
+void USCCurveAnimComponent::SetAnimatedTransform(const FTransform &Transform) {
+  if (TransformSpace == ESCTransformSpace::Local) {
+    SetRelativeTransform(Transform);
+  } else {
+    SetWorldTransform(Transform);
+  }
+
+  if (bUseKinematicTarget != bKinematicChildrenResolved) {
+    if (bUseKinematicTarget) {
+      ResolveKinematicChildren();
+    } else {
+      ReleaseKinematicChildren();
+    }
+  }
+  if (bUseKinematicTarget) {
+    ApplyKinematicChildren();
+  }
+}
+
+void USCCurveAnimComponent::ApplyCustomData() {
+  const TArray<FSCAnimCustomOp> &Ops = EvalPlan.GetCustomOps();
+  CustomValues.SetNumUninitialized(Ops.Num());
+  EvalPlan.EvaluateCustom(CurrentTime, CustomValues);
+
+  int32 First = 0;
+  while (First < Ops.Num()) {
+    const uint8 Target = Ops[First].Target;
+    int32 End = First + 1;
+    while (End < Ops.Num() && Ops[End].Target == Target) {
+      ++End;
+    }
+
+    const TArrayView<const FSCAnimCustomOp> TargetOps =
+        MakeArrayView(Ops).Slice(First, End - First);
+    const TArrayView<const float> TargetValues =
+        MakeArrayView(CustomValues).Slice(First, End - First);
+    if (Target == 0) {
+      for (USceneComponent *Child : GetAttachChildren()) {
+        if (UPrimitiveComponent *Primitive = Cast<UPrimitiveComponent>(Child)) {
+          SCCurveAnim::WriteCustomPrimitiveData(*Primitive, TargetOps,
+                                                TargetValues);
         }
-        break;
-      case ESCCurveTrackType::VectorScale:
-        NewScale = Track.bAddBaseValue ? InitialScale + Value : Value;
-        break;
-      default:
-        break;
       }
+    } else if (UPrimitiveComponent *Primitive = Cast<UPrimitiveComponent>(
+                   BoundTargets[Target - 1].Component.Get())) {
+      SCCurveAnim::WriteCustomPrimitiveData(*Primitive, TargetOps,
+                                            TargetValues);
     }
+    First = End;
   }
+}
 
-  if (TransformSpace == ESCTransformSpace::Local) {
-    SetRelativeLocationAndRotation(NewLoc, NewRot);
-    SetRelativeScale3D(NewScale);
+void USCCurveAnimComponent::ResolveKinematicChildren() {
+  bKinematicChildrenResolved = true;
+  for (USceneComponent *Child : GetAttachChildren()) {
+    UPrimitiveComponent *Primitive = Cast<UPrimitiveComponent>(Child);
+    if (!Primitive || !SCCurveAnim::HasKinematicBody(*Primitive) ||
+        BoundTargets.ContainsByPredicate([Child](const FBoundTarget &Target) {
+          return Target.Component == Child;
+        })) {
+      continue;
+    }
+
+    KinematicChildren.Add({Primitive, Primitive->GetRelativeTransform()});
+    const FTransform World = Primitive->GetComponentTransform();
+    Primitive->SetUsingAbsoluteLocation(true);
+    Primitive->SetUsingAbsoluteRotation(true);
+    Primitive->SetUsingAbsoluteScale(true);
+    Primitive->SetWorldTransform(World);
+  }
+}
+
+void USCCurveAnimComponent::ReleaseKinematicChildren() {
+  for (const FKinematicChild &Child : KinematicChildren) {
+    if (UPrimitiveComponent *Primitive = Child.Primitive.Get()) {
+      Primitive->SetUsingAbsoluteLocation(false);
+      Primitive->SetUsingAbsoluteRotation(false);
+      Primitive->SetUsingAbsoluteScale(false);
+      Primitive->SetRelativeTransform(Child.Base);
+    }
+  }
+  KinematicChildren.Reset();
+  bKinematicChildrenResolved = false;
+}
+
+void USCCurveAnimComponent::ApplyKinematicChildren() {
+  const FTransform &World = GetComponentTransform();
+  for (const FKinematicChild &Child : KinematicChildren) {
+    UPrimitiveComponent *Primitive = Child.Primitive.Get();
+    if (!Primitive || Primitive->IsSimulatingPhysics()) {
+      continue;
+    }
+
+    const FTransform Target = Child.Base * World;
+    if (!SCCurveAnim::SetKinematicTarget(*Primitive, Target)) {
+      Primitive->SetWorldTransform(Target);
+    }
+  }
+}
+
+void USCCurveAnimComponent::BeginExternalControl() {
+  if (!HasBegunPlay()) {
+    InitialLocation = GetRelativeLocation();
+    InitialRotation = GetRelativeRotation();
+    InitialScale = GetRelativeScale3D();
+  }
+
+  bExternallyControlled = true;
+  ExternalSampleSerial = 0;
+  UpdateTickState();
+}
+
+void USCCurveAnimComponent::EndExternalControl() {
+  bExternallyControlled = false;
+  ExternalPlans.Reset();
+  ExternalSequences.Reset();
+  UpdateTickState();
+}
+
+void USCCurveAnimComponent::ApplyExternalSample(USCAnimSequence *Sequence,
+                                                float Time, float Weight) {
+  if (!Sequence || Weight <= 0.0f) {
+    return;
+  }
+
+  if (ExternalSampleSerial != ExternalEvaluationSerial) {
+    ExternalSampleSerial = ExternalEvaluationSerial;
+    ExternalWeight = 0.0f;
+    ExternalBlend = FTransform(FQuat(0.0, 0.0, 0.0, 0.0), FVector::ZeroVector,
+                               FVector::ZeroVector);
+  }
+
+  Sequence->EnsureEvaluationData();
+  FSCAnimEvalPlan *Plan =
+      ExternalPlans.FindByPredicate([Sequence](const FSCAnimEvalPlan &Entry) {
+        return Entry.GetSequence() == Sequence;
+      });
+  if (!Plan) {
+    Plan = &ExternalPlans.AddDefaulted_GetRef();
+    ExternalSequences.Add(Sequence);
+  }
+  if (!Plan->IsBuiltFor(Sequence)) {
+    Plan->Build(Sequence);
+  }
+
+  FSCAnimChannelValues Values;
+  Plan->Evaluate(Time, Values);
+  ExternalBlend.AccumulateWithShortestRotation(
+      Plan->Compose(Values, InitialLocation, InitialRotation, InitialScale),
+      ScalarRegister(Weight));
+  ExternalWeight += Weight;
+
+  FTransform Result = ExternalBlend;
+  if (ExternalWeight < 1.0f) {
+    Result.AccumulateWithShortestRotation(
+        FTransform(InitialRotation, InitialLocation, InitialScale),
+        ScalarRegister(1.0f - ExternalWeight));
   } else {
-    SetWorldLocationAndRotation(NewLoc, NewRot);
-    SetWorldScale3D(NewScale);
+    Result.SetTranslation(Result.GetTranslation() / ExternalWeight);
+    Result.SetScale3D(Result.GetScale3D() / ExternalWeight);
+  }
+  Result.NormalizeRotation();
+  SetAnimatedTransform(Result);
+}
+
+void USCCurveAnimComponent::UpdateTickState() {
+  const bool bActive =
+      bIsPlaying && !bIsPaused && AnimSequence && !bExternallyControlled;
+
+  UWorld *World = GetWorld();
+  USCCurveAnimSubsystem *Subsystem =
+      bUseBatchedEvaluation && World
+          ? World->GetSubsystem<USCCurveAnimSubsystem>()
+          : nullptr;
+  if (Subsystem) {
+    if (bActive) {
+      Subsystem->Register(this);
+    } else {
+      Subsystem->Unregister(this);
+    }
+  }
+
+  const bool bWantsTick = bActive && !Subsystem;
+  if (bWantsTick && !IsComponentTickEnabled()) {
+    SignificanceState.Reset();
   }
+  SetComponentTickEnabled(bWantsTick);
 }
 
-void USCCurveAnimComponent::ProcessNotifies(float OldTime, float NewTime) {
-  if (!AnimSequence) {
+void USCCurveAnimComponent::ProcessNotifies(const FSCAnimPlaybackStep &Step,
+                                            float ReferenceScale) {
+  const TArray<FSCAnimPlanNotify> &Notifies = EvalPlan.GetNotifies();
+  const int32 NumNotifies = Notifies.Num();
+  if (NumNotifies == 0) {
     return;
   }
 
-  bool bIsForward = NewTime >= OldTime;
-  float MinTime = FMath::Min(OldTime, NewTime);
-  float MaxTime = FMath::Max(OldTime, NewTime);
+  if (FiredNotifies.Num() != NumNotifies) {
+    FiredNotifies.Init(false, NumNotifies);
+    NotifyCursor = INDEX_NONE;
+  }
 
-  for (int32 i = 0; i < AnimSequence->Notifies.Num(); ++i) {
-    const FSCAnimNotify &Notify = AnimSequence->Notifies[i];
+  const bool bForward = Step.Direction > 0.0f;
+  const float PrevTime = Step.PrevTime * ReferenceScale;
+  const float NewTime = Step.Time * ReferenceScale;
+  const float EndTime = PlaybackDuration * ReferenceScale;
+  const uint32 Serial = PlaybackSerial;
 
-    // If we are looping/resetting, we might want to handle that differently,
-    // but basic range check works for linear playback.
+  if (NotifyCursor == INDEX_NONE) {
+    NotifyCursor = bForward ? EvalPlan.CountNotifiesAtOrBefore(PrevTime)
+                            : EvalPlan.CountNotifiesBefore(PrevTime);
+  }
 
-    if (FiredNotifyIndices.Contains(i))
-      continue;
+  for (int32 Pass = 0; Pass <= Step.NumWraps; ++Pass) {
+    if (Pass > 0) {
+      FiredNotifies.Init(false, NumNotifies);
+      NotifyCursor = bForward ? EvalPlan.CountNotifiesAtOrBefore(0.0f)
+                              : EvalPlan.CountNotifiesBefore(EndTime);
+    }
 
-    bool bShouldTrigger = false;
-    // Check inclusive/exclusive correctly to avoid double firing on boundaries
-    if (bIsForward) {
-      bShouldTrigger = (Notify.Time > MinTime && Notify.Time <= MaxTime);
+    const float PassEnd = Pass == Step.NumWraps ? NewTime
+                          : bForward            ? EndTime
+                                                : 0.0f;
+    if (bForward) {
+      while (NotifyCursor < NumNotifies &&
+             Notifies[NotifyCursor].Time <= PassEnd) {
+        if (!FireNotify(NotifyCursor++, Serial)) {
+          return;
+        }
+      }
     } else {
-      bShouldTrigger = (Notify.Time >= MinTime && Notify.Time < MaxTime);
+      while (NotifyCursor > 0 && Notifies[NotifyCursor - 1].Time >= PassEnd) {
+        if (!FireNotify(--NotifyCursor, Serial)) {
+          return;
+        }
+      }
     }
+  }
+}
+
+bool USCCurveAnimComponent::FireNotify(int32 SortedIndex, uint32 Serial) {
+  if (FiredNotifies[SortedIndex]) {
+    return true;
+  }
+
+  FiredNotifies[SortedIndex] = true;
+  const FName Name = EvalPlan.GetNotifies()[SortedIndex].Name;
 
-    if (bShouldTrigger) {
-      OnAnimationNotify.Broadcast(Notify.NotifyName);
-      FiredNotifyIndices.Add(i);
+  if (ActiveHandleSlot != INDEX_NONE &&
+      HandleSlots[ActiveHandleSlot].Delegates.OnNotify.IsBound()) {
+    const FSCAnimHandleNotifyDelegate Delegate =
+        HandleSlots[ActiveHandleSlot].Delegates.OnNotify;
+    Delegate.Execute(MakeHandle(ActiveHandleSlot), Name);
+    if (PlaybackSerial != Serial) {
+      return false;
     }
   }
+
+  OnAnimationNotifyNative.Broadcast(Name);
+  if (PlaybackSerial != Serial) {
+    return false;
+  }
+
+  OnAnimationNotify.Broadcast(Name);
+  return PlaybackSerial == Serial;
+}
+
+void USCCurveAnimComponent::ResetNotifyCursor(bool bClearFired) {
+  NotifyCursor = INDEX_NONE;
+  ++PlaybackSerial;
+  if (bClearFired) {
+    FiredNotifies.Init(false, EvalPlan.GetNotifies().Num());
+  }
 }
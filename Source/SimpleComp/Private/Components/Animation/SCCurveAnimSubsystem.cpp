@@ -0,0 +1,176 @@
+#include "Components/Animation/SCCurveAnimSubsystem.h"
+#include "Async/ParallelFor.h"
+#include "Components/Animation/SCAnimSequence.h"
+#include "Components/Animation/SCCurveAnimComponent.h"
+
+namespace SCCurveAnimSubsystem {
+constexpr int32 ChunkSize = 64;
+} // namespace SCCurveAnimSubsystem
+
+void USCCurveAnimSubsystem::Tick(float DeltaTime) {
+  Super::Tick(DeltaTime);
+
+  RemovePending();
+
+  const int32 NumEntries = Components.Num();
+  if (NumEntries == 0) {
+    return;
+  }
+
+  // Plans are rebuilt here, on the game thread, so the parallel pass only
+  // reads them. A component whose sequence was cleared without stopping
+  // leaves the batch, as Register would not accept it.
+  Plans.SetNumUninitialized(NumEntries);
+  for (int32 Index = 0; Index < NumEntries; ++Index) {
+    USCCurveAnimComponent *Component = Components[Index];
+    Plans[Index] = nullptr;
+    if (!IsValid(Component)) {
+      Components[Index] = nullptr;
+      continue;
+    }
+    if (!Component->AnimSequence) {
+      Unregister(Component);
+      continue;
+    }
+    Component->RefreshEvalPlan();
+    Plans[Index] = &Component->EvalPlan;
+  }
+
+  Steps.SetNumUninitialized(NumEntries);
+  Values.SetNumUninitialized(NumEntries);
+
+  const int32 NumChunks =
+      FMath::DivideAndRoundUp(NumEntries, SCCurveAnimSubsystem::ChunkSize);
+  ParallelFor(
+      NumChunks,
+      [this, DeltaTime, NumEntries](int32 Chunk) {
+        const int32 First = Chunk * SCCurveAnimSubsystem::ChunkSize;
+        const int32 Last =
+            FMath::Min(First + SCCurveAnimSubsystem::ChunkSize, NumEntries);
+        for (int32 Index = First; Index < Last; ++Index) {
+          if (!Plans[Index]) {
+            continue;
+          }
+          const FSCAnimEvalPlan &Plan = *Plans[Index];
+          const FSCAnimPlaybackStep Step = SCAnimPlayback::Advance(
+              Times[Index], DeltaTime, Rates[Index], Directions[Index],
+              Durations[Index], Loops[Index] != 0);
+
+          Times[Index] = Step.Time;
+          Steps[Index] = Step;
+          Resynced[Index] = 0;
+          Plan.Evaluate(Step.Time * Plan.GetReferenceDuration() /
+                            Durations[Index],
+                        Values[Index]);
+        }
+      },
+      NumChunks > 1 ? EParallelForFlags::None
+                    : EParallelForFlags::ForceSingleThread);
+
+  for (int32 Index = 0; Index < NumEntries; ++Index) {
+    USCCurveAnimComponent *Component = Components[Index];
+    if (!IsValid(Component)) {
+      Components[Index] = nullptr;
+      continue;
+    }
+    if (!Plans[Index] || Resynced[Index]) {
+      continue;
+    }
+
+    // Events committed earlier in this pass may have restarted the component
+    // on another sequence; that re-registers it and sets Resynced.
+    Component->CommitStep(Steps[Index],
+                          Plans[Index]->GetReferenceDuration() /
+                              Durations[Index],
+                          Values[Index]);
+
+    if (Component->BatchIndex == Index) {
+      Rates[Index] = Component->PlayRate;
+      Loops[Index] = Component->bLoop ? 1 : 0;
+    }
+  }
+}
+
+TStatId USCCurveAnimSubsystem::GetStatId() const {
+  RETURN_QUICK_DECLARE_CYCLE_STAT(USCCurveAnimSubsystem, STATGROUP_Tickables);
+}
+
+void USCCurveAnimSubsystem::Deinitialize() {
+  for (USCCurveAnimComponent *Component : Components) {
+    if (Component) {
+      Component->BatchIndex = INDEX_NONE;
+    }
+  }
+
+  Components.Reset();
+  Times.Reset();
+  Rates.Reset();
+  Directions.Reset();
+  Durations.Reset();
+  Loops.Reset();
+  Resynced.Reset();
+  Plans.Reset();
+  Steps.Reset();
+  Values.Reset();
+
+  Super::Deinitialize();
+}
+
+void USCCurveAnimSubsystem::Register(USCCurveAnimComponent *Component) {
+  if (!Component || !Component->AnimSequence ||
+      Component->PlaybackDuration <= 0.0f) {
+    Unregister(Component);
+    return;
+  }
+
+  int32 Index = Component->BatchIndex;
+  if (Index == INDEX_NONE) {
+    Index = Components.Add(Component);
+    Times.AddZeroed();
+    Rates.AddZeroed();
+    Directions.AddZeroed();
+    Durations.AddZeroed();
+    Loops.AddZeroed();
+    Resynced.AddZeroed();
+    Component->BatchIndex = Index;
+  }
+
+  Times[Index] = Component->PlaybackCurrentTime;
+  Rates[Index] = Component->PlayRate;
+  Directions[Index] = Component->bReversePlayback ? -1.0f : 1.0f;
+  Durations[Index] = Component->PlaybackDuration;
+  Loops[Index] = Component->bLoop ? 1 : 0;
+  Resynced[Index] = 1;
+}
+
+void USCCurveAnimSubsystem::Unregister(USCCurveAnimComponent *Component) {
+  if (!Component || Component->BatchIndex == INDEX_NONE) {
+    return;
+  }
+
+  Components[Component->BatchIndex] = nullptr;
+  Component->BatchIndex = INDEX_NONE;
+}
+
+void USCCurveAnimSubsystem::RemovePending() {
+  for (int32 Index = Components.Num() - 1; Index >= 0; --Index) {
+    if (IsValid(Components[Index])) {
+      continue;
+    }
+    if (Components[Index]) {
+      Components[Index]->BatchIndex = INDEX_NONE;
+    }
+
+    Components.RemoveAtSwap(Index);
+    Times.RemoveAtSwap(Index);
+    Rates.RemoveAtSwap(Index);
+    Directions.RemoveAtSwap(Index);
+    Durations.RemoveAtSwap(Index);
+    Loops.RemoveAtSwap(Index);
+    Resynced.RemoveAtSwap(Index);
+
+    if (Components.IsValidIndex(Index)) {
+      Components[Index]->BatchIndex = Index;
+    }
+  }
+}
@@ -0,0 +1,388 @@
+#include "Components/Animation/SCInstancedCurveAnimComponent.h"
+#include "Async/ParallelFor.h"
+#include "Components/Animation/SCAnimSequence.h"
+#include "Components/InstancedStaticMeshComponent.h"
+#include "GameFramework/Actor.h"
+
+namespace SCInstancedCurveAnim {
+constexpr int32 ChunkSize = 256;
+} // namespace SCInstancedCurveAnim
+
+USCInstancedCurveAnimComponent::USCInstancedCurveAnimComponent() {
+  PrimaryComponentTick.bCanEverTick = true;
+  PrimaryComponentTick.bStartWithTickEnabled = false;
+}
+
+void USCInstancedCurveAnimComponent::BeginPlay() {
+  Super::BeginPlay();
+
+  InstanceIndexUpdatedHandle =
+      FInstancedStaticMeshDelegates::OnInstanceIndexUpdated.AddUObject(
+          this, &USCInstancedCurveAnimComponent::OnInstanceIndexUpdated);
+
+  if (bAutoPlay && AnimSequence) {
+    Play();
+  }
+}
+
+void USCInstancedCurveAnimComponent::EndPlay(
+    const EEndPlayReason::Type EndPlayReason) {
+  FInstancedStaticMeshDelegates::OnInstanceIndexUpdated.Remove(
+      InstanceIndexUpdatedHandle);
+  InstanceIndexUpdatedHandle.Reset();
+
+  Super::EndPlay(EndPlayReason);
+}
+
+void USCInstancedCurveAnimComponent::TickComponent(
+    float DeltaTime, ELevelTick TickType,
+    FActorComponentTickFunction *ThisTickFunction) {
+  Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+
+  const float StepTime =
+      SignificanceState.Update(*this, Significance, DeltaTime);
+
+  UInstancedStaticMeshComponent *Mesh = ResolveInstancedMesh();
+  if (!Mesh || !AnimSequence || PlaybackDuration <= 0.0f) {
+    SetComponentTickEnabled(false);
+    return;
+  }
+
+  SyncInstanceCount(*Mesh);
+  if (NumPlaying == 0) {
+    UpdateTickState();
+    return;
+  }
+
+  AnimSequence->EnsureEvaluationData();
+  if (!EvalPlan.IsBuiltFor(AnimSequence)) {
+    EvalPlan.Build(AnimSequence);
+  }
+
+  const float ReferenceScale =
+      EvalPlan.GetReferenceDuration() / PlaybackDuration;
+  const int32 NumInstances = Times.Num();
+  const int32 NumChunks =
+      FMath::DivideAndRoundUp(NumInstances, SCInstancedCurveAnim::ChunkSize);
+  const int32 NumCustom = EvalPlan.GetNumSelfCustomOps();
+  CustomValues.SetNumUninitialized(NumInstances * NumCustom);
+
+  ParallelFor(
+      NumChunks,
+      [this, StepTime, ReferenceScale, NumInstances, NumCustom](int32 Chunk) {
+        const int32 First = Chunk * SCInstancedCurveAnim::ChunkSize;
+        const int32 Last =
+            FMath::Min(First + SCInstancedCurveAnim::ChunkSize, NumInstances);
+        for (int32 Index = First; Index < Last; ++Index) {
+          if (!Playing[Index]) {
+            continue;
+          }
+
+          // Negative rates play backward, so they wrap and finish at 0.
+          const float Rate = Rates[Index];
+          const FSCAnimPlaybackStep Step = SCAnimPlayback::Advance(
+              Times[Index], StepTime, FMath::Abs(Rate),
+              Rate < 0.0f ? -1.0f : 1.0f, PlaybackDuration,
+              Loops[Index] != 0);
+          Times[Index] = Step.Time;
+          if (Step.bFinished) {
+            Playing[Index] = 0;
+            FinishedThisFrame[Index] = 1;
+          }
+
+          FSCAnimChannelValues Values;
+          EvalPlan.Evaluate(Step.Time * ReferenceScale, Values);
+          Transforms[Index] =
+              EvalPlan.Compose(Values, BaseLocations[Index],
+                               BaseRotations[Index], BaseScales[Index]);
+          if (NumCustom > 0) {
+            EvalPlan.EvaluateCustom(
+                Step.Time * ReferenceScale,
+                MakeArrayView(CustomValues).Slice(Index * NumCustom,
+                                                  NumCustom));
+          }
+        }
+      },
+      NumChunks > 1 ? EParallelForFlags::None
+                    : EParallelForFlags::ForceSingleThread);
+
+  if (NumCustom > 0) {
+    WriteCustomData(*Mesh, NumCustom);
+  }
+  WriteTransforms(*Mesh);
+
+  int32 NumFinished = 0;
+  for (const uint8 bFinished : FinishedThisFrame) {
+    NumFinished += bFinished;
+  }
+  NumPlaying -= NumFinished;
+
+  for (int32 Index = 0; NumFinished > 0 && Index < FinishedThisFrame.Num();
+       ++Index) {
+    if (FinishedThisFrame[Index]) {
+      FinishedThisFrame[Index] = 0;
+      --NumFinished;
+      OnInstanceFinished.Broadcast(Index);
+    }
+  }
+
+  UpdateTickState();
+}
+
+void USCInstancedCurveAnimComponent::Play() {
+  UInstancedStaticMeshComponent *Mesh = ResolveInstancedMesh();
+  if (!Mesh || !AnimSequence || PlaybackDuration <= 0.0f) {
+    return;
+  }
+
+  SyncInstanceCount(*Mesh);
+  for (int32 Index = 0; Index < Times.Num(); ++Index) {
+    const float StartTime = RandomTimeOffset > 0.0f
+                                ? FMath::FRandRange(0.0f, RandomTimeOffset)
+                                : 0.0f;
+    StartInstance(Index, StartTime, PlayRate, bLoop);
+  }
+  UpdateTickState();
+}
+
+void USCInstancedCurveAnimComponent::PlayInstance(int32 InstanceIndex,
+                                                  float StartTime,
+                                                  float InPlayRate,
+                                                  bool bInLoop) {
+  UInstancedStaticMeshComponent *Mesh = ResolveInstancedMesh();
+  if (!Mesh || !AnimSequence || PlaybackDuration <= 0.0f) {
+    return;
+  }
+
+  SyncInstanceCount(*Mesh);
+  if (!Times.IsValidIndex(InstanceIndex)) {
+    return;
+  }
+
+  StartInstance(InstanceIndex, StartTime, InPlayRate, bInLoop);
+  UpdateTickState();
+}
+
+void USCInstancedCurveAnimComponent::Stop() {
+  FMemory::Memzero(Playing.GetData(), Playing.Num());
+  NumPlaying = 0;
+  UpdateTickState();
+}
+
+void USCInstancedCurveAnimComponent::StopInstance(int32 InstanceIndex) {
+  if (Playing.IsValidIndex(InstanceIndex) && Playing[InstanceIndex]) {
+    Playing[InstanceIndex] = 0;
+    --NumPlaying;
+    UpdateTickState();
+  }
+}
+
+void USCInstancedCurveAnimComponent::SetInstancePlayRate(int32 InstanceIndex,
+                                                         float InPlayRate) {
+  if (Rates.IsValidIndex(InstanceIndex)) {
+    Rates[InstanceIndex] = InPlayRate;
+  }
+}
+
+void USCInstancedCurveAnimComponent::RefreshInstances() {
+  UInstancedStaticMeshComponent *Mesh = ResolveInstancedMesh();
+  if (!Mesh) {
+    return;
+  }
+
+  SyncInstanceCount(*Mesh);
+  for (int32 Index = 0; Index < Times.Num(); ++Index) {
+    CaptureBase(*Mesh, Index);
+  }
+}
+
+bool USCInstancedCurveAnimComponent::IsInstancePlaying(
+    int32 InstanceIndex) const {
+  return Playing.IsValidIndex(InstanceIndex) && Playing[InstanceIndex] != 0;
+}
+
+UInstancedStaticMeshComponent *
+USCInstancedCurveAnimComponent::ResolveInstancedMesh() {
+  if (!IsValid(CachedMesh)) {
+    AActor *Owner = GetOwner();
+    CachedMesh = Cast<UInstancedStaticMeshComponent>(
+        InstancedMesh.GetComponent(Owner));
+    if (!CachedMesh && Owner) {
+      CachedMesh = Owner->FindComponentByClass<UInstancedStaticMeshComponent>();
+    }
+  }
+  return CachedMesh;
+}
+
+void USCInstancedCurveAnimComponent::SyncInstanceCount(
+    const UInstancedStaticMeshComponent &Mesh) {
+  const int32 NumInstances = Mesh.GetInstanceCount();
+  const int32 OldNum = Times.Num();
+  if (NumInstances == OldNum) {
+    return;
+  }
+
+  for (int32 Index = NumInstances; Index < OldNum; ++Index) {
+    if (Playing[Index]) {
+      --NumPlaying;
+    }
+  }
+
+  BaseLocations.SetNum(NumInstances);
+  BaseRotations.SetNum(NumInstances);
+  BaseScales.SetNum(NumInstances);
+  Times.SetNumZeroed(NumInstances);
+  Rates.SetNumZeroed(NumInstances);
+  Loops.SetNumZeroed(NumInstances);
+  Playing.SetNumZeroed(NumInstances);
+  FinishedThisFrame.SetNumZeroed(NumInstances);
+  Transforms.SetNum(NumInstances);
+
+  for (int32 Index = OldNum; Index < NumInstances; ++Index) {
+    CaptureBase(Mesh, Index);
+  }
+}
+
+void USCInstancedCurveAnimComponent::CaptureBase(
+    const UInstancedStaticMeshComponent &Mesh, int32 InstanceIndex) {
+  FTransform Transform;
+  Mesh.GetInstanceTransform(InstanceIndex, Transform, false);
+  BaseLocations[InstanceIndex] = Transform.GetLocation();
+  BaseRotations[InstanceIndex] = Transform.Rotator();
+  BaseScales[InstanceIndex] = Transform.GetScale3D();
+  Transforms[InstanceIndex] = Transform;
+}
+
+void USCInstancedCurveAnimComponent::OnInstanceIndexUpdated(
+    UInstancedStaticMeshComponent *Component,
+    TArrayView<const FInstancedStaticMeshDelegates::FInstanceIndexUpdateData>
+        IndexUpdates) {
+  if (Component != CachedMesh) {
+    return;
+  }
+
+  // Removals arrive as a Removed update followed by the relocations the mesh
+  // made to fill the gap: one for a swap removal, one per shifted instance
+  // otherwise. The stale tail is trimmed by the next SyncInstanceCount.
+  using EUpdateType = FInstancedStaticMeshDelegates::EInstanceIndexUpdateType;
+  for (const FInstancedStaticMeshDelegates::FInstanceIndexUpdateData &Update :
+       IndexUpdates) {
+    switch (Update.Type) {
+    case EUpdateType::Added:
+      // The instance reuses a slot left stale by an earlier removal.
+      if (Times.IsValidIndex(Update.Index)) {
+        CaptureBase(*Component, Update.Index);
+      }
+      break;
+    case EUpdateType::Removed:
+      if (Playing.IsValidIndex(Update.Index) && Playing[Update.Index]) {
+        Playing[Update.Index] = 0;
+        --NumPlaying;
+      }
+      break;
+    case EUpdateType::Relocated:
+      if (Times.IsValidIndex(Update.OldIndex) &&
+          Times.IsValidIndex(Update.Index)) {
+        MoveInstance(Update.OldIndex, Update.Index);
+      }
+      break;
+    case EUpdateType::Cleared:
+    case EUpdateType::Destroyed:
+      FMemory::Memzero(Playing.GetData(), Playing.Num());
+      NumPlaying = 0;
+      break;
+    default:
+      break;
+    }
+  }
+}
+
+void USCInstancedCurveAnimComponent::MoveInstance(int32 From, int32 To) {
+  if (Playing[To]) {
+    --NumPlaying;
+  }
+  BaseLocations[To] = BaseLocations[From];
+  BaseRotations[To] = BaseRotations[From];
+  BaseScales[To] = BaseScales[From];
+  Times[To] = Times[From];
+  Rates[To] = Rates[From];
+  Loops[To] = Loops[From];
+  Playing[To] = Playing[From];
+  FinishedThisFrame[To] = FinishedThisFrame[From];
+  Transforms[To] = Transforms[From];
+
+  Playing[From] = 0;
+  FinishedThisFrame[From] = 0;
+}
+
+void USCInstancedCurveAnimComponent::StartInstance(int32 InstanceIndex,
+                                                   float StartTime,
+                                                   float InPlayRate,
+                                                   bool bInLoop) {
+  float Time = FMath::Clamp(StartTime, 0.0f, PlaybackDuration);
+  if (bInLoop) {
+    Time = FMath::Fmod(StartTime, PlaybackDuration);
+    if (Time < 0.0f) {
+      Time += PlaybackDuration;
+    }
+  }
+
+  if (!Playing[InstanceIndex]) {
+    Playing[InstanceIndex] = 1;
+    ++NumPlaying;
+  }
+  Times[InstanceIndex] = Time;
+  Rates[InstanceIndex] = InPlayRate;
+  Loops[InstanceIndex] = bInLoop ? 1 : 0;
+}
+
+void USCInstancedCurveAnimComponent::WriteCustomData(
+    UInstancedStaticMeshComponent &Mesh, int32 NumCustom) {
+  const TArray<FSCAnimCustomOp> &Ops = EvalPlan.GetCustomOps();
+  const int32 NumFloats = Ops[NumCustom - 1].DataIndex + 1;
+  if (Mesh.NumCustomDataFloats < NumFloats) {
+    // Resizing zeroes the data of every instance, including slots the tracks
+    // do not drive, so the previous values are copied into the new layout.
+    const int32 OldNumFloats = Mesh.NumCustomDataFloats;
+    const TArray<float> OldData = Mesh.PerInstanceSMCustomData;
+    Mesh.SetNumCustomDataFloats(NumFloats);
+    if (OldNumFloats > 0) {
+      const int32 NumOld = OldData.Num() / OldNumFloats;
+      for (int32 Index = 0; Index < NumOld; ++Index) {
+        Mesh.SetCustomData(
+            Index,
+            MakeArrayView(OldData).Slice(Index * OldNumFloats, OldNumFloats),
+            false);
+      }
+    }
+  }
+
+  for (int32 Index = 0; Index < Times.Num(); ++Index) {
+    if (!Playing[Index] && !FinishedThisFrame[Index]) {
+      continue;
+    }
+    const float *Values = &CustomValues[Index * NumCustom];
+    for (int32 Op = 0; Op < NumCustom; ++Op) {
+      Mesh.SetCustomDataValue(Index, Ops[Op].DataIndex, Values[Op], false);
+    }
+  }
+}
+
+void USCInstancedCurveAnimComponent::WriteTransforms(
+    UInstancedStaticMeshComponent &Mesh) {
+  for (int32 Index = 0; Index < Times.Num(); ++Index) {
+    if (Playing[Index] || FinishedThisFrame[Index]) {
+      Mesh.UpdateInstanceTransform(Index, Transforms[Index], false, false,
+                                   false);
+    }
+  }
+  Mesh.MarkRenderStateDirty();
+}
+
+void USCInstancedCurveAnimComponent::UpdateTickState() {
+  const bool bWantsTick = NumPlaying > 0 && AnimSequence;
+  if (bWantsTick && !IsComponentTickEnabled()) {
+    SignificanceState.Reset();
+  }
+  SetComponentTickEnabled(bWantsTick);
+}
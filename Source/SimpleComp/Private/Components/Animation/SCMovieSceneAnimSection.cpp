@@ -0,0 +1,65 @@
+#include "Components/Animation/SCMovieSceneAnimSection.h"
+#include "Channels/MovieSceneChannelProxy.h"
+#include "Components/Animation/SCAnimSequence.h"
+#include "MovieScene.h"
+
+USCMovieSceneAnimSection::USCMovieSceneAnimSection(
+    const FObjectInitializer &ObjectInitializer)
+    : Super(ObjectInitializer) {
+  EvalOptions.EnableAndSetCompletionMode(
+      EMovieSceneCompletionMode::RestoreState);
+  Weight.SetDefault(1.0f);
+
+  FMovieSceneChannelProxyData Channels;
+#if WITH_EDITOR
+  FMovieSceneChannelMetaData MetaData;
+  MetaData.SetIdentifiers(
+      TEXT("Weight"),
+      NSLOCTEXT("SCMovieSceneAnimSection", "WeightText", "Weight"));
+  Channels.Add(Weight, MetaData, TMovieSceneExternalValue<float>());
+#else
+  Channels.Add(Weight);
+#endif
+  ChannelProxy = MakeShared<FMovieSceneChannelProxy>(MoveTemp(Channels));
+}
+
+float USCMovieSceneAnimSection::GetSequenceTime(
+    FFrameTime Time, FFrameRate TickResolution) const {
+  const float Duration = Sequence ? Sequence->GetReferenceDuration() : 0.0f;
+  if (Duration <= 0.0f) {
+    return 0.0f;
+  }
+
+  const FFrameNumber Start =
+      HasStartFrame() ? GetInclusiveStartFrame() : FFrameNumber(0);
+  const float Elapsed =
+      StartOffset +
+      static_cast<float>(TickResolution.AsSeconds(Time - Start)) * PlayRate;
+
+  if (bLoop) {
+    return FMath::Fmod(FMath::Max(Elapsed, 0.0f), Duration);
+  }
+  return FMath::Clamp(Elapsed, 0.0f, Duration);
+}
+
+float USCMovieSceneAnimSection::GetWeight(FFrameTime Time) const {
+  float ChannelWeight = 1.0f;
+  Weight.Evaluate(Time, ChannelWeight);
+  return ChannelWeight * EvaluateEasing(Time);
+}
+
+TOptional<TRange<FFrameNumber>>
+USCMovieSceneAnimSection::GetAutoSizeRange() const {
+  const UMovieScene *MovieScene = GetTypedOuter<UMovieScene>();
+  if (!Sequence || !MovieScene || !HasStartFrame() || PlayRate <= 0.0f) {
+    return TOptional<TRange<FFrameNumber>>();
+  }
+
+  const float Seconds =
+      FMath::Max(Sequence->GetReferenceDuration() - StartOffset, 0.0f) /
+      PlayRate;
+  const FFrameNumber Start = GetInclusiveStartFrame();
+  const FFrameNumber End =
+      Start + (Seconds * MovieScene->GetTickResolution()).CeilToFrame();
+  return TRange<FFrameNumber>(Start, End);
+}
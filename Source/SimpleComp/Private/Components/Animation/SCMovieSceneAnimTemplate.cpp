@@ -0,0 +1,149 @@
+#include "Components/Animation/SCMovieSceneAnimTemplate.h"
+#include "Components/Animation/SCCurveAnimComponent.h"
+#include "Components/Animation/SCMovieSceneAnimSection.h"
+#include "Evaluation/MovieSceneEvaluation.h"
+#include "Evaluation/MovieSceneExecutionTokens.h"
+#include "Evaluation/PersistentEvaluationData.h"
+#include "GameFramework/Actor.h"
+#include "IMovieScenePlayer.h"
+
+namespace SCMovieSceneAnim {
+USCCurveAnimComponent *ResolveComponent(UObject *Object) {
+  if (USCCurveAnimComponent *Component = Cast<USCCurveAnimComponent>(Object)) {
+    return Component;
+  }
+  const AActor *Actor = Cast<AActor>(Object);
+  return Actor ? Actor->FindComponentByClass<USCCurveAnimComponent>()
+               : nullptr;
+}
+
+struct FPreAnimatedToken : IMovieScenePreAnimatedToken {
+  explicit FPreAnimatedToken(const FTransform &InTransform)
+      : Transform(InTransform) {}
+
+  virtual void
+  RestoreState(UObject &Object,
+               const UE::MovieScene::FRestoreStateParams &Params) override {
+    USCCurveAnimComponent *Component =
+        CastChecked<USCCurveAnimComponent>(&Object);
+    Component->SetRelativeTransform(Transform);
+    Component->EndExternalControl();
+  }
+
+  FTransform Transform;
+};
+
+struct FPreAnimatedTokenProducer : IMovieScenePreAnimatedTokenProducer {
+  static FMovieSceneAnimTypeID GetAnimTypeID() {
+    return TMovieSceneAnimTypeID<FPreAnimatedTokenProducer>();
+  }
+
+  virtual void InitializeObjectForAnimation(UObject &Object) const override {
+    CastChecked<USCCurveAnimComponent>(&Object)->BeginExternalControl();
+  }
+
+  virtual IMovieScenePreAnimatedTokenPtr
+  CacheExistingState(UObject &Object) const override {
+    return FPreAnimatedToken(
+        CastChecked<USCCurveAnimComponent>(&Object)->GetRelativeTransform());
+  }
+};
+
+/** Components a section has taken control of, released on tear down. */
+struct FControlledComponents : IPersistentEvaluationData {
+  TArray<TWeakObjectPtr<USCCurveAnimComponent>> Components;
+};
+
+struct FSampleToken : IMovieSceneExecutionToken {
+  FSampleToken(USCAnimSequence *InSequence, float InTime, float InWeight)
+      : Sequence(InSequence), Time(InTime), Weight(InWeight) {}
+
+  virtual void Execute(const FMovieSceneContext &Context,
+                       const FMovieSceneEvaluationOperand &Operand,
+                       FPersistentEvaluationData &PersistentData,
+                       IMovieScenePlayer &Player) override {
+    for (TWeakObjectPtr<> WeakObject : Player.FindBoundObjects(Operand)) {
+      USCCurveAnimComponent *Component = ResolveComponent(WeakObject.Get());
+      if (!Component) {
+        continue;
+      }
+
+      Player.SavePreAnimatedState(*Component,
+                                  FPreAnimatedTokenProducer::GetAnimTypeID(),
+                                  FPreAnimatedTokenProducer());
+      // Another section may have released the component since its state was
+      // saved.
+      if (!Component->IsExternallyControlled()) {
+        Component->BeginExternalControl();
+      }
+      PersistentData.GetOrAddSectionData<FControlledComponents>()
+          .Components.AddUnique(Component);
+      Component->ApplyExternalSample(Sequence, Time, Weight);
+    }
+  }
+
+  USCAnimSequence *Sequence;
+  float Time;
+  float Weight;
+};
+
+struct FEndEvaluationToken : IMovieSceneSharedExecutionToken {
+  static FMovieSceneSharedDataId GetSharedId() {
+    static const FMovieSceneSharedDataId Id =
+        FMovieSceneSharedDataId::Allocate();
+    return Id;
+  }
+
+  virtual void Execute(FPersistentEvaluationData &PersistentData,
+                       IMovieScenePlayer &Player) override {
+    USCCurveAnimComponent::AdvanceExternalEvaluation();
+  }
+};
+} // namespace SCMovieSceneAnim
+
+FSCMovieSceneAnimSectionTemplate::FSCMovieSceneAnimSectionTemplate() {
+  EnableOverrides(RequiresTearDownFlag);
+}
+
+void FSCMovieSceneAnimSectionTemplate::Evaluate(
+    const FMovieSceneEvaluationOperand &Operand,
+    const FMovieSceneContext &Context,
+    const FPersistentEvaluationData &PersistentData,
+    FMovieSceneExecutionTokens &ExecutionTokens) const {
+  const USCMovieSceneAnimSection *Section =
+      Cast<USCMovieSceneAnimSection>(GetSourceSection());
+  if (!Section || !Section->Sequence) {
+    return;
+  }
+
+  const FFrameTime Time = Context.GetTime();
+  const float Weight = Section->GetWeight(Time);
+  if (Weight <= 0.0f) {
+    return;
+  }
+
+  ExecutionTokens.Add(SCMovieSceneAnim::FSampleToken(
+      Section->Sequence,
+      Section->GetSequenceTime(Time, Context.GetFrameRate()), Weight));
+  ExecutionTokens.AddShared(
+      SCMovieSceneAnim::FEndEvaluationToken::GetSharedId(),
+      SCMovieSceneAnim::FEndEvaluationToken());
+}
+
+void FSCMovieSceneAnimSectionTemplate::TearDown(
+    FPersistentEvaluationData &PersistentData,
+    IMovieScenePlayer &Player) const {
+  // Keep State sections never restore their pre-animated state, so control
+  // is released here rather than only in FPreAnimatedToken::RestoreState.
+  using SCMovieSceneAnim::FControlledComponents;
+  if (const FControlledComponents *Controlled =
+          PersistentData.FindSectionData<FControlledComponents>()) {
+    for (const TWeakObjectPtr<USCCurveAnimComponent> &Component :
+         Controlled->Components) {
+      if (Component.IsValid() && Component->IsExternallyControlled()) {
+        Component->EndExternalControl();
+      }
+    }
+  }
+  PersistentData.ResetSectionData();
+}
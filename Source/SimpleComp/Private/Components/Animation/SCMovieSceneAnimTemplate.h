@@ -0,0 +1,34 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Evaluation/MovieSceneEvalTemplate.h"
+#include "SCMovieSceneAnimTemplate.generated.h"
+
+/**
+ * Evaluation template of USCMovieSceneAnimSection. Each evaluation blends a
+ * weighted sample of the section's sequence into every bound
+ * USCCurveAnimComponent. Samples are applied through execution tokens on the
+ * game thread, one component at a time.
+ */
+USTRUCT()
+struct FSCMovieSceneAnimSectionTemplate : public FMovieSceneEvalTemplate {
+  GENERATED_BODY()
+
+  FSCMovieSceneAnimSectionTemplate();
+
+private:
+  virtual UScriptStruct &GetScriptStructImpl() const override {
+    return *StaticStruct();
+  }
+
+  virtual void Evaluate(const FMovieSceneEvaluationOperand &Operand,
+                        const FMovieSceneContext &Context,
+                        const FPersistentEvaluationData &PersistentData,
+                        FMovieSceneExecutionTokens &ExecutionTokens) const
+      override;
+
+  /** Hands the components the section drove back to their own playback,
+   * whatever the section's completion mode. */
+  virtual void TearDown(FPersistentEvaluationData &PersistentData,
+                        IMovieScenePlayer &Player) const override;
+};
@@ -0,0 +1,66 @@
+#include "Components/Animation/SCMovieSceneAnimTrack.h"
+#include "Components/Animation/SCMovieSceneAnimSection.h"
+#include "Components/Animation/SCMovieSceneAnimTemplate.h"
+
+#define LOCTEXT_NAMESPACE "SCMovieSceneAnimTrack"
+
+USCMovieSceneAnimTrack::USCMovieSceneAnimTrack(
+    const FObjectInitializer &ObjectInitializer)
+    : Super(ObjectInitializer) {
+#if WITH_EDITORONLY_DATA
+  TrackTint = FColor(204, 102, 0, 65);
+#endif
+}
+
+bool USCMovieSceneAnimTrack::SupportsType(
+    TSubclassOf<UMovieSceneSection> SectionClass) const {
+  return SectionClass == USCMovieSceneAnimSection::StaticClass();
+}
+
+UMovieSceneSection *USCMovieSceneAnimTrack::CreateNewSection() {
+  return NewObject<USCMovieSceneAnimSection>(this, NAME_None,
+                                             RF_Transactional);
+}
+
+const TArray<UMovieSceneSection *> &
+USCMovieSceneAnimTrack::GetAllSections() const {
+  return AnimationSections;
+}
+
+bool USCMovieSceneAnimTrack::HasSection(
+    const UMovieSceneSection &Section) const {
+  return AnimationSections.Contains(&Section);
+}
+
+void USCMovieSceneAnimTrack::AddSection(UMovieSceneSection &Section) {
+  AnimationSections.Add(&Section);
+}
+
+void USCMovieSceneAnimTrack::RemoveSection(UMovieSceneSection &Section) {
+  AnimationSections.Remove(&Section);
+}
+
+void USCMovieSceneAnimTrack::RemoveSectionAt(int32 SectionIndex) {
+  AnimationSections.RemoveAt(SectionIndex);
+}
+
+void USCMovieSceneAnimTrack::RemoveAllAnimationData() {
+  AnimationSections.Empty();
+}
+
+bool USCMovieSceneAnimTrack::IsEmpty() const {
+  return AnimationSections.Num() == 0;
+}
+
+#if WITH_EDITORONLY_DATA
+FText USCMovieSceneAnimTrack::GetDefaultDisplayName() const {
+  return LOCTEXT("DisplayName", "Simple Animation");
+}
+#endif
+
+FMovieSceneEvalTemplatePtr USCMovieSceneAnimTrack::CreateTemplateForSection(
+    const UMovieSceneSection &InSection) const {
+  return FSCMovieSceneAnimSectionTemplate();
+}
+
+#undef LOCTEXT_NAMESPACE
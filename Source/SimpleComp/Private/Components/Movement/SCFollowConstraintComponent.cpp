@@ -1,6 +1,14 @@
 #include "Components/Movement/SCFollowConstraintComponent.h"
 #include "GameFramework/Actor.h"
 
+namespace SCFollowConstraint {
+/** Tick interval while idle, bounding how long a FollowTarget or
+ * ChainFollowers assigned directly takes to be picked up. */
+constexpr float IdleTickInterval = 0.5f;
+/** Update rate ChainDamping is expressed at. */
+constexpr float DampingRate = 60.0f;
+} // namespace SCFollowConstraint
+
 USCFollowConstraintComponent::USCFollowConstraintComponent() {
   PrimaryComponentTick.bCanEverTick = true;
   PrimaryComponentTick.TickGroup = TG_PostUpdateWork;
@@ -21,18 +29,84 @@ void USCFollowConstraintComponent::BeginPlay() {
   }
 }
 
+void USCFollowConstraintComponent::SetFollowTarget(AActor *NewTarget) {
+  FollowTarget = NewTarget;
+  UpdateTickState();
+}
+
+void USCFollowConstraintComponent::SetChainFollowers(
+    const TArray<AActor *> &NewFollowers) {
+  ChainFollowers.Reset(NewFollowers.Num());
+  ChainFollowers.Append(NewFollowers);
+  ChainPrevPositions.Reset();
+  UpdateTickState();
+}
+
+#if WITH_EDITOR
+void USCFollowConstraintComponent::PostEditChangeProperty(
+    FPropertyChangedEvent &PropertyChangedEvent) {
+  Super::PostEditChangeProperty(PropertyChangedEvent);
+  const FName PropertyName = PropertyChangedEvent.GetMemberPropertyName();
+  if (PropertyName == GET_MEMBER_NAME_CHECKED(ThisClass, ChainFollowers)) {
+    ChainPrevPositions.Reset();
+  }
+  // Edits made while playing in editor bypass the setters.
+  UpdateTickState();
+}
+#endif
+
+bool USCFollowConstraintComponent::WantsTick() const {
+  return FollowTarget != nullptr || ChainFollowers.Num() > 0;
+}
+
+void USCFollowConstraintComponent::UpdateTickState() {
+  if (bIdle && WantsTick() && HasBegunPlay()) {
+    if (AActor *Owner = GetOwner()) {
+      LastLocation = Owner->GetActorLocation();
+    }
+    ChainPrevPositions.Reset();
+    SignificanceState.Reset();
+    SetComponentTickInterval(0.0f);
+    bIdle = false;
+  }
+}
+
 void USCFollowConstraintComponent::TickComponent(
-    float DeltaTime, ELevelTick TickType,
+    float TickDeltaTime, ELevelTick TickType,
     FActorComponentTickFunction *ThisTickFunction) {
-  Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+  Super::TickComponent(TickDeltaTime, TickType, ThisTickFunction);
 
+  // Idle components keep a slow tick rather than none, so a FollowTarget or
+  // ChainFollowers written directly still wakes them.
   AActor *Owner = GetOwner();
-  if (!FollowTarget || !Owner) {
+  if (!Owner || !WantsTick()) {
+    if (!bIdle) {
+      bIdle = true;
+      SetComponentTickInterval(SCFollowConstraint::IdleTickInterval);
+    }
+    return;
+  }
+  if (bIdle) {
+    // Idle time is not simulated; the next tick runs at the normal rate
+    UpdateTickState();
     return;
   }
 
+  const float DeltaTime =
+      SignificanceState.Update(*this, Significance, TickDeltaTime);
+
+  if (FollowTarget) {
+    FollowTargetActor(*Owner, DeltaTime);
+  }
+
+  LastLocation = Owner->GetActorLocation();
+  SolveChain(*Owner, DeltaTime);
+}
+
+void USCFollowConstraintComponent::FollowTargetActor(AActor &Owner,
+                                                     float DeltaTime) {
   const FVector TargetLoc = FollowTarget->GetActorLocation();
-  const FVector CurrentLoc = Owner->GetActorLocation();
+  const FVector CurrentLoc = Owner.GetActorLocation();
 
   // 1. Calculate Target XY/Z based on constraints
   // We only care about direction if the distance is exceeded
@@ -64,50 +138,122 @@ void USCFollowConstraintComponent::TickComponent(
                         ? CurrentLoc.Z
                         : TargetLoc.Z + NewRelativeLoc.Z;
 
-    Owner->SetActorLocation(NewLocation);
+    Owner.SetActorLocation(NewLocation);
 
     // 2. Calculate rotation based on movement delta
     FVector MoveDelta = NewLocation - LastLocation;
 
     if (MoveDelta.SizeSquared() > KINDA_SMALL_NUMBER) {
-      // Create a target Quaternion from the movement direction
-      FQuat TargetQuat = MoveDelta.ToOrientationQuat();
-      FRotator TargetRotator = TargetQuat.Rotator();
-
-      // Apply rotation constraints
-      FRotator FinalRotator;
-      FinalRotator.Pitch = (PitchSettings.Mode == ESCAxisMode::Locked)
-                               ? Owner->GetActorRotation().Pitch
-                               : TargetRotator.Pitch;
-      FinalRotator.Yaw = (YawSettings.Mode == ESCAxisMode::Locked)
-                             ? Owner->GetActorRotation().Yaw
-                             : TargetRotator.Yaw;
-      FinalRotator.Roll = (RollSettings.Mode == ESCAxisMode::Locked)
-                              ? Owner->GetActorRotation().Roll
-                              : TargetRotator.Roll;
-
-      // Handle 'Limited' mode if needed (could be expanded)
-      if (PitchSettings.Mode == ESCAxisMode::Limited)
-        FinalRotator.Pitch = FMath::Clamp(FinalRotator.Pitch, PitchSettings.Min,
-                                          PitchSettings.Max);
-      if (YawSettings.Mode == ESCAxisMode::Limited)
-        FinalRotator.Yaw =
-            FMath::Clamp(FinalRotator.Yaw, YawSettings.Min, YawSettings.Max);
-      if (RollSettings.Mode == ESCAxisMode::Limited)
-        FinalRotator.Roll =
-            FMath::Clamp(FinalRotator.Roll, RollSettings.Min, RollSettings.Max);
-
-      FQuat FinalQuat = FinalRotator.Quaternion();
-      FQuat CurrentQuat = Owner->GetActorQuat();
+      // Create a target Quaternion from the movement direction and apply
+      // rotation constraints. Locked axes keep the owner's current value
+      AxisConstraint.Update(PitchSettings, YawSettings, RollSettings);
+      FQuat CurrentQuat = Owner.GetActorQuat();
+      FQuat FinalQuat =
+          AxisConstraint.Apply(MoveDelta.ToOrientationQuat(), CurrentQuat);
 
       // Slerp for smooth rotation
       float LerpAlpha =
           FMath::Clamp(DeltaTime * RotationSmoothness, 0.0f, 1.0f);
       FQuat NewQuat = FQuat::Slerp(CurrentQuat, FinalQuat, LerpAlpha);
 
-      Owner->SetActorRotation(NewQuat);
+      Owner.SetActorRotation(NewQuat);
     }
   }
+}
 
-  LastLocation = Owner->GetActorLocation();
+void USCFollowConstraintComponent::SolveChain(const AActor &Owner,
+                                              float DeltaTime) {
+  const int32 NumLinks = ChainFollowers.Num();
+  if (NumLinks == 0) {
+    return;
+  }
+
+  const FVector AxisMask(XAxisSettings.Mode == ESCAxisMode::Locked ? 0.0 : 1.0,
+                         YAxisSettings.Mode == ESCAxisMode::Locked ? 0.0 : 1.0,
+                         ZAxisSettings.Mode == ESCAxisMode::Locked ? 0.0 : 1.0);
+
+  // 1. Gather follower transforms into contiguous arrays
+  ChainPositions.SetNumUninitialized(NumLinks);
+  ChainRotations.SetNumUninitialized(NumLinks);
+  for (int32 Index = 0; Index < NumLinks; ++Index) {
+    const AActor *Follower = ChainFollowers[Index];
+    if (IsValid(Follower)) {
+      ChainPositions[Index] = Follower->GetActorLocation();
+      ChainRotations[Index] = Follower->GetActorQuat();
+    }
+  }
+  if (ChainPrevPositions.Num() != NumLinks) {
+    ChainPrevPositions = ChainPositions;
+    ChainPrevDeltaTime = 0.0f;
+  }
+
+  // 2. Time-corrected Verlet step: keep last update's velocity, rescaled to
+  // this step, and add gravity, so the motion does not depend on the tick
+  // rate
+  if (bChainVerlet && DeltaTime > 0.0f) {
+    const float PrevDeltaTime =
+        ChainPrevDeltaTime > 0.0f ? ChainPrevDeltaTime : DeltaTime;
+    const double Retained =
+        FMath::Pow(1.0 - ChainDamping,
+                   DeltaTime * SCFollowConstraint::DampingRate) *
+        DeltaTime / PrevDeltaTime;
+    const FVector Acceleration = ChainGravity * AxisMask *
+                                 (DeltaTime * (DeltaTime + PrevDeltaTime) *
+                                  0.5);
+    for (int32 Index = 0; Index < NumLinks; ++Index) {
+      if (IsValid(ChainFollowers[Index])) {
+        const FVector Position = ChainPositions[Index];
+        ChainPositions[Index] +=
+            (Position - ChainPrevPositions[Index]) * AxisMask * Retained +
+            Acceleration;
+        ChainPrevPositions[Index] = Position;
+      }
+    }
+    ChainPrevDeltaTime = DeltaTime;
+  }
+
+  // 3. Rope constraints front to back, each link pulled toward the one ahead
+  const int32 Iterations = bChainVerlet ? ChainIterations : 1;
+  const double Stiffness = bChainVerlet ? ChainStiffness : 1.0;
+  for (int32 Iteration = 0; Iteration < Iterations; ++Iteration) {
+    FVector Leader = Owner.GetActorLocation();
+    for (int32 Index = 0; Index < NumLinks; ++Index) {
+      if (!IsValid(ChainFollowers[Index])) {
+        continue;
+      }
+
+      FVector &Position = ChainPositions[Index];
+      const FVector Direction = (Position - Leader) * AxisMask;
+      const double Distance = Direction.Size();
+      if (Distance > RopeLength) {
+        Position -=
+            Direction * ((Distance - RopeLength) / Distance * Stiffness);
+      }
+      Leader = Position;
+    }
+  }
+
+  // 4. Face each link toward the one ahead and write all transforms
+  AxisConstraint.Update(PitchSettings, YawSettings, RollSettings);
+  const float LerpAlpha =
+      FMath::Clamp(DeltaTime * RotationSmoothness, 0.0f, 1.0f);
+  FVector Leader = Owner.GetActorLocation();
+  for (int32 Index = 0; Index < NumLinks; ++Index) {
+    AActor *Follower = ChainFollowers[Index];
+    if (!IsValid(Follower)) {
+      continue;
+    }
+
+    const FVector &Position = ChainPositions[Index];
+    const FVector Facing = Leader - Position;
+    if (Facing.SizeSquared() > KINDA_SMALL_NUMBER) {
+      const FQuat &CurrentQuat = ChainRotations[Index];
+      ChainRotations[Index] = FQuat::Slerp(
+          CurrentQuat,
+          AxisConstraint.Apply(Facing.ToOrientationQuat(), CurrentQuat),
+          LerpAlpha);
+    }
+    Follower->SetActorLocationAndRotation(Position, ChainRotations[Index]);
+    Leader = Position;
+  }
 }
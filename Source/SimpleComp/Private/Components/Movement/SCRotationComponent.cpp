@@ -1,4 +1,8 @@
 #include "Components/Movement/SCRotationComponent.h"
+#include "Components/Movement/SCRotationSubsystem.h"
+#include "Components/Movement/SCTargetingSubsystem.h"
+#include "Components/PrimitiveComponent.h"
+#include "Engine/World.h"
 #include "GameFramework/Actor.h"
 #include "Kismet/KismetMathLibrary.h"
 
@@ -11,20 +15,143 @@ void USCRotationComponent::BeginPlay() {
   Super::BeginPlay();
   LastLocation = GetComponentLocation();
   bLastLookAtTarget = bLookAtTarget;
+  InitialQuat = GetRelativeRotation().Quaternion();
+
+  if (bAutoAcquireTarget && RotationMode == ESCRotationMode::ToTarget) {
+    if (USCTargetingSubsystem *Targeting =
+            GetWorld()->GetSubsystem<USCTargetingSubsystem>()) {
+      Targeting->AddSeeker(this);
+    }
+  }
+
+  if (UsesSpinCustomData()) {
+    WriteSpinCustomData();
+    SetComponentTickEnabled(false);
+    return;
+  }
+
+  if (bUseBatchedEvaluation) {
+    if (USCRotationSubsystem *Subsystem =
+            GetWorld()->GetSubsystem<USCRotationSubsystem>()) {
+      Subsystem->Register(this);
+      SetComponentTickEnabled(false);
+    }
+  }
+}
+
+void USCRotationComponent::EndPlay(const EEndPlayReason::Type EndPlayReason) {
+  if (SeekerIndex != INDEX_NONE) {
+    if (USCTargetingSubsystem *Targeting =
+            GetWorld()->GetSubsystem<USCTargetingSubsystem>()) {
+      Targeting->RemoveSeeker(this);
+    }
+  }
+
+  if (bUseBatchedEvaluation) {
+    if (USCRotationSubsystem *Subsystem =
+            GetWorld()->GetSubsystem<USCRotationSubsystem>()) {
+      Subsystem->Unregister(this);
+    }
+  }
+
+  Super::EndPlay(EndPlayReason);
 }
 
 void USCRotationComponent::TickComponent(
-    float DeltaTime, ELevelTick TickType,
+    float TickDeltaTime, ELevelTick TickType,
     FActorComponentTickFunction *ThisTickFunction) {
-  Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+  Super::TickComponent(TickDeltaTime, TickType, ThisTickFunction);
+
+  // Activate or SetActive can re-enable the tick while the subsystem owns
+  // this component; it would be updated twice per frame otherwise.
+  if (BatchIndex != INDEX_NONE) {
+    return;
+  }
+
+  const float DeltaTime =
+      SignificanceState.Update(*this, Significance, TickDeltaTime);
 
-  // Constant rotation: Standard local additive rotation
   if (RotationMode == ESCRotationMode::Constant && bLookAtTarget) {
-    AddLocalRotation(FQuat(RotationRate * DeltaTime));
+    SetRelativeRotation(ComputeConstantRotation(
+        GetRelativeRotation().Quaternion(), DeltaTime));
     return;
   }
 
-  FQuat TargetWorldQuat = GetComponentQuat();
+  const FQuat TargetWorldQuat = ComputeTargetWorldQuat();
+  const FQuat ParentQuat =
+      GetAttachParent() ? GetAttachParent()->GetComponentQuat()
+                        : FQuat::Identity;
+  SetRelativeRotation(SolveRotation(TargetWorldQuat, ParentQuat,
+                                    GetRelativeRotation().Quaternion(),
+                                    DeltaTime, bIsSwitchingTarget));
+}
+
+FQuat USCRotationComponent::ComputeConstantRotation(const FQuat &CurrentQuat,
+                                                    float DeltaTime) const {
+  // Standard local additive rotation
+  if (ConstantMethod == ESCConstantRotationMethod::Accumulate) {
+    return CurrentQuat * FQuat(RotationRate * DeltaTime);
+  }
+
+  FVector Axis;
+  double Speed;
+  GetSpinAxisAndSpeed(Axis, Speed);
+  const double Time = GetWorld()->GetTimeSeconds() + RotationPhase;
+  return InitialQuat * FQuat(Axis, FMath::Fmod(Speed * Time, UE_DOUBLE_TWO_PI));
+}
+
+void USCRotationComponent::GetSpinAxisAndSpeed(FVector &OutAxis,
+                                               double &OutSpeed) const {
+  // Axis of a short step, so rates above half a turn per second do not wrap
+  constexpr double Step = 1.0 / 1024.0;
+  double Angle;
+  FQuat(RotationRate * Step).ToAxisAndAngle(OutAxis, Angle);
+  OutSpeed = Angle / Step;
+}
+
+void USCRotationComponent::RefreshSpinCustomData() {
+  if (HasBegunPlay() && UsesSpinCustomData()) {
+    WriteSpinCustomData();
+  }
+}
+
+void USCRotationComponent::OnChildAttached(USceneComponent *ChildComponent) {
+  Super::OnChildAttached(ChildComponent);
+  RefreshSpinCustomData();
+}
+
+#if WITH_EDITOR
+void USCRotationComponent::PostEditChangeProperty(
+    FPropertyChangedEvent &PropertyChangedEvent) {
+  Super::PostEditChangeProperty(PropertyChangedEvent);
+  // Edits made while playing in editor
+  RefreshSpinCustomData();
+}
+#endif
+
+bool USCRotationComponent::UsesSpinCustomData() const {
+  return RotationMode == ESCRotationMode::Constant && bLookAtTarget &&
+         ConstantMethod == ESCConstantRotationMethod::CustomPrimitiveData;
+}
+
+void USCRotationComponent::WriteSpinCustomData() {
+  FVector Axis;
+  double Speed;
+  GetSpinAxisAndSpeed(Axis, Speed);
+  const double Phase = FMath::Fmod(Speed * RotationPhase, UE_DOUBLE_TWO_PI);
+
+  for (USceneComponent *Child : GetAttachChildren()) {
+    if (UPrimitiveComponent *Primitive = Cast<UPrimitiveComponent>(Child)) {
+      Primitive->SetCustomPrimitiveDataVector3(SpinCustomDataIndex,
+                                               FVector3f(Axis));
+      Primitive->SetCustomPrimitiveDataVector2(
+          SpinCustomDataIndex + 3, FVector2f(float(Speed), float(Phase)));
+    }
+  }
+}
+
+FQuat USCRotationComponent::ComputeTargetWorldQuat() {
+  AxisConstraint.Update(PitchSettings, YawSettings, RollSettings);
 
   // Toggle detection for bLookAtTarget to trigger Switch speed
   if (bLookAtTarget != bLastLookAtTarget) {
@@ -32,62 +159,41 @@ void USCRotationComponent::TickComponent(
     bLastLookAtTarget = bLookAtTarget;
   }
 
-  // Step 1: Calculate Target World Orientation
-  if (bLookAtTarget) {
-    switch (RotationMode) {
-    case ESCRotationMode::ToTarget:
-      TargetWorldQuat = ComputeTargetQuat();
-      break;
-    case ESCRotationMode::ToVelocity:
-      TargetWorldQuat = ComputeVelocityQuat();
-      break;
-    case ESCRotationMode::ToForwardDelta:
-      TargetWorldQuat = ComputeForwardDeltaQuat();
-      break;
-    default:
-      break;
-    }
-  } else {
+  if (!bLookAtTarget) {
     // Smooth return to zero: Target becomes parent orientation (Identity in
     // local space)
-    if (GetAttachParent()) {
-      TargetWorldQuat = GetAttachParent()->GetComponentQuat();
-    } else {
-      TargetWorldQuat = FQuat::Identity;
-    }
     LastTargetActor = nullptr;
+    return GetAttachParent() ? GetAttachParent()->GetComponentQuat()
+                             : FQuat::Identity;
   }
 
-  // Step 2: Convert World Target to Local Space for constraints
-  FRotator LocalTargetRot = FRotator::ZeroRotator;
-  if (GetAttachParent()) {
-    // Equivalent to NormalizedDeltaRotator but using Quat math for stability
-    FQuat LocalQuat =
-        GetAttachParent()->GetComponentQuat().Inverse() * TargetWorldQuat;
-    LocalTargetRot = LocalQuat.Rotator();
-  } else {
-    LocalTargetRot = TargetWorldQuat.Rotator();
+  switch (RotationMode) {
+  case ESCRotationMode::ToTarget:
+    return ComputeTargetQuat();
+  case ESCRotationMode::ToVelocity:
+    return ComputeVelocityQuat();
+  case ESCRotationMode::ToForwardDelta:
+    return ComputeForwardDeltaQuat();
+  default:
+    return GetComponentQuat();
   }
+}
 
-  // Step 3: Apply individual axis logic (Locked/Limited/Free)
-  FRotator FinalLocalTargetRot;
-  FinalLocalTargetRot.Pitch = ProcessAxis(LocalTargetRot.Pitch, PitchSettings);
-  FinalLocalTargetRot.Yaw = ProcessAxis(LocalTargetRot.Yaw, YawSettings);
-  FinalLocalTargetRot.Roll = ProcessAxis(LocalTargetRot.Roll, RollSettings);
-
-  const FQuat CurrentQuat = GetRelativeRotation().Quaternion();
-  const FQuat TargetQuat = FQuat(FinalLocalTargetRot);
-
-  // Step 4: Update Switching State
-  UpdateTargetSwitching(CurrentQuat, TargetQuat);
-
-  // Step 5: Smooth Interpolation via QInterpTo (Slerp)
-  float ActiveSpeed =
-      bIsSwitchingTarget ? SwitchInterpSpeed : DefaultInterpSpeed;
-  const FQuat ResultQuat =
-      FMath::QInterpTo(CurrentQuat, TargetQuat, DeltaTime, ActiveSpeed);
+FQuat USCRotationComponent::SolveRotation(const FQuat &TargetWorldQuat,
+                                          const FQuat &ParentQuat,
+                                          const FQuat &CurrentQuat,
+                                          float DeltaTime,
+                                          bool &bSwitching) const {
+  // Convert World Target to Local Space and apply individual axis logic
+  // (Locked/Limited/Free) in quaternion space
+  const FQuat TargetQuat =
+      AxisConstraint.Apply(ParentQuat.Inverse() * TargetWorldQuat);
+  UpdateTargetSwitching(CurrentQuat, TargetQuat, bSwitching);
 
-  SetRelativeRotation(ResultQuat);
+  // Smooth Interpolation via QInterpTo (Slerp)
+  const float ActiveSpeed =
+      bSwitching ? SwitchInterpSpeed : DefaultInterpSpeed;
+  return FMath::QInterpTo(CurrentQuat, TargetQuat, DeltaTime, ActiveSpeed);
 }
 
 FQuat USCRotationComponent::ComputeTargetQuat() {
@@ -96,15 +202,24 @@ FQuat USCRotationComponent::ComputeTargetQuat() {
       bIsSwitchingTarget = true;
       LastTargetActor = TargetActor;
     }
-    FVector Direction =
-        (TargetActor->GetActorLocation() + TargetLocationOffset) -
-        GetComponentLocation();
+    FVector Direction = (GetTargetActorLocation() + TargetLocationOffset) -
+                        GetComponentLocation();
     return Direction.IsNearlyZero() ? GetComponentQuat()
                                     : Direction.ToOrientationQuat();
   }
   return GetComponentQuat();
 }
 
+FVector USCRotationComponent::GetTargetActorLocation() const {
+  if (BatchIndex != INDEX_NONE) {
+    if (USCRotationSubsystem *Subsystem =
+            GetWorld()->GetSubsystem<USCRotationSubsystem>()) {
+      return Subsystem->GetTargetLocation(*TargetActor);
+    }
+  }
+  return TargetActor->GetActorLocation();
+}
+
 /**
  * Calculates world orientation based on velocity.
  * Prioritizes Parent Component velocity, falling back to Actor velocity if
@@ -147,28 +262,13 @@ FQuat USCRotationComponent::ComputeForwardDeltaQuat() {
 }
 
 void USCRotationComponent::UpdateTargetSwitching(const FQuat &CurrentQuat,
-                                                 const FQuat &TargetQuat) {
-  if (bIsSwitchingTarget) {
+                                                 const FQuat &TargetQuat,
+                                                 bool &bSwitching) const {
+  if (bSwitching) {
     float AngleDiff =
         FMath::RadiansToDegrees(CurrentQuat.AngularDistance(TargetQuat));
     if (AngleDiff <= SwitchThreshold) {
-      bIsSwitchingTarget = false;
+      bSwitching = false;
     }
   }
 }
-
-float USCRotationComponent::ProcessAxis(float TargetAngle,
-                                        const FSCAxisSettings &Settings) {
-  switch (Settings.Mode) {
-  case ESCAxisMode::Locked:
-    return 0.0f;
-
-  case ESCAxisMode::Limited:
-    return FMath::Clamp(FMath::UnwindDegrees(TargetAngle), Settings.Min,
-                        Settings.Max);
-
-  case ESCAxisMode::Free:
-  default:
-    return TargetAngle;
-  }
-}
\ No newline at end of file
@@ -0,0 +1,158 @@
+#include "Components/Movement/SCRotationSubsystem.h"
+#include "Async/ParallelFor.h"
+#include "Components/Movement/SCRotationComponent.h"
+#include "GameFramework/Actor.h"
+
+namespace SCRotationSubsystem {
+constexpr int32 ChunkSize = 64;
+} // namespace SCRotationSubsystem
+
+void USCRotationSubsystem::Tick(float DeltaTime) {
+  Super::Tick(DeltaTime);
+
+  RemovePending();
+
+  const int32 NumEntries = Components.Num();
+  if (NumEntries == 0) {
+    return;
+  }
+
+  TargetQuats.SetNumUninitialized(NumEntries);
+  ParentQuats.SetNumUninitialized(NumEntries);
+  CurrentQuats.SetNumUninitialized(NumEntries);
+  Results.SetNumUninitialized(NumEntries);
+  StepTimes.SetNumUninitialized(NumEntries);
+  Constant.SetNumUninitialized(NumEntries);
+  Switching.SetNumUninitialized(NumEntries);
+  TargetLocations.Reset();
+
+  for (int32 Index = 0; Index < NumEntries; ++Index) {
+    USCRotationComponent *Component = Components[Index];
+    CurrentQuats[Index] = Component->GetRelativeRotation().Quaternion();
+    StepTimes[Index] = Component->SignificanceState.UpdateBatched(
+        *Component, Component->Significance, DeltaTime);
+    if (StepTimes[Index] <= 0.0f) {
+      // Throttled this frame; flagged constant so the solve pass skips it
+      Constant[Index] = true;
+      Results[Index] = CurrentQuats[Index];
+      continue;
+    }
+
+    Constant[Index] =
+        Component->RotationMode == ESCRotationMode::Constant &&
+        Component->bLookAtTarget;
+    if (Constant[Index]) {
+      Results[Index] = Component->ComputeConstantRotation(CurrentQuats[Index],
+                                                          StepTimes[Index]);
+      continue;
+    }
+
+    const USceneComponent *Parent = Component->GetAttachParent();
+    TargetQuats[Index] = Component->ComputeTargetWorldQuat();
+    ParentQuats[Index] =
+        Parent ? Parent->GetComponentQuat() : FQuat::Identity;
+    Switching[Index] = Component->bIsSwitchingTarget;
+  }
+
+  const int32 NumChunks =
+      FMath::DivideAndRoundUp(NumEntries, SCRotationSubsystem::ChunkSize);
+  ParallelFor(
+      NumChunks,
+      [this, NumEntries](int32 Chunk) {
+        const int32 First = Chunk * SCRotationSubsystem::ChunkSize;
+        const int32 Last =
+            FMath::Min(First + SCRotationSubsystem::ChunkSize, NumEntries);
+        for (int32 Index = First; Index < Last; ++Index) {
+          if (Constant[Index]) {
+            continue;
+          }
+
+          bool bSwitching = Switching[Index] != 0;
+          Results[Index] = Components[Index]->SolveRotation(
+              TargetQuats[Index], ParentQuats[Index], CurrentQuats[Index],
+              StepTimes[Index], bSwitching);
+          Switching[Index] = bSwitching;
+        }
+      },
+      NumChunks > 1 ? EParallelForFlags::None
+                    : EParallelForFlags::ForceSingleThread);
+
+  for (int32 Index = 0; Index < NumEntries; ++Index) {
+    USCRotationComponent *Component = Components[Index];
+    if (!IsValid(Component)) {
+      Components[Index] = nullptr;
+      continue;
+    }
+    if (StepTimes[Index] <= 0.0f) {
+      continue;
+    }
+    if (!Constant[Index]) {
+      Component->bIsSwitchingTarget = Switching[Index] != 0;
+    }
+    Component->SetRelativeRotation(Results[Index]);
+  }
+}
+
+TStatId USCRotationSubsystem::GetStatId() const {
+  RETURN_QUICK_DECLARE_CYCLE_STAT(USCRotationSubsystem, STATGROUP_Tickables);
+}
+
+void USCRotationSubsystem::Deinitialize() {
+  for (USCRotationComponent *Component : Components) {
+    if (Component) {
+      Component->BatchIndex = INDEX_NONE;
+    }
+  }
+
+  Components.Reset();
+  TargetQuats.Reset();
+  ParentQuats.Reset();
+  CurrentQuats.Reset();
+  Results.Reset();
+  StepTimes.Reset();
+  Constant.Reset();
+  Switching.Reset();
+  TargetLocations.Reset();
+
+  Super::Deinitialize();
+}
+
+void USCRotationSubsystem::Register(USCRotationComponent *Component) {
+  if (!Component || Component->BatchIndex != INDEX_NONE) {
+    return;
+  }
+
+  Component->BatchIndex = Components.Add(Component);
+}
+
+void USCRotationSubsystem::Unregister(USCRotationComponent *Component) {
+  if (!Component || Component->BatchIndex == INDEX_NONE) {
+    return;
+  }
+
+  Components[Component->BatchIndex] = nullptr;
+  Component->BatchIndex = INDEX_NONE;
+}
+
+FVector USCRotationSubsystem::GetTargetLocation(const AActor &Actor) {
+  if (const FVector *Cached = TargetLocations.Find(&Actor)) {
+    return *Cached;
+  }
+  return TargetLocations.Add(&Actor, Actor.GetActorLocation());
+}
+
+void USCRotationSubsystem::RemovePending() {
+  for (int32 Index = Components.Num() - 1; Index >= 0; --Index) {
+    if (IsValid(Components[Index])) {
+      continue;
+    }
+    if (Components[Index]) {
+      Components[Index]->BatchIndex = INDEX_NONE;
+    }
+
+    Components.RemoveAtSwap(Index);
+    if (Components.IsValidIndex(Index)) {
+      Components[Index]->BatchIndex = Index;
+    }
+  }
+}
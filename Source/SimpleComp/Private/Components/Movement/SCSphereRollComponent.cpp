@@ -6,6 +6,7 @@ USCSphereRollComponent::USCSphereRollComponent()
 	PrimaryComponentTick.bCanEverTick = true;
 	PrimaryComponentTick.bStartWithTickEnabled = true;
 	bTickInEditor = false;
+	bWantsOnUpdateTransform = true;
 
 	CurrentRotationQuat = FQuat::Identity;
 }
@@ -17,9 +18,22 @@ void USCSphereRollComponent::BeginPlay()
 	CurrentRotationQuat = GetRelativeRotation().Quaternion();
 }
 
-void USCSphereRollComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
+void USCSphereRollComponent::OnUpdateTransform(EUpdateTransformFlags UpdateTransformFlags, ETeleportType Teleport)
 {
-	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+	Super::OnUpdateTransform(UpdateTransformFlags, Teleport);
+
+	if (HasBegunPlay() && !IsComponentTickEnabled())
+	{
+		SignificanceState.Reset();
+		SetComponentTickEnabled(true);
+	}
+}
+
+void USCSphereRollComponent::TickComponent(float TickDeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
+{
+	Super::TickComponent(TickDeltaTime, TickType, ThisTickFunction);
+
+	const float DeltaTime = SignificanceState.Update(*this, Significance, TickDeltaTime);
 
 	if (DeltaTime <= 0.0f) return;
 
@@ -52,6 +66,10 @@ void USCSphereRollComponent::TickComponent(float DeltaTime, ELevelTick TickType,
 			SetRelativeRotation(CurrentRotationQuat);
 		}
 	}
+	else
+	{
+		SetComponentTickEnabled(false);
+	}
 
 	LastLocation = CurrentLocation;
 }
\ No newline at end of file
@@ -0,0 +1,341 @@
+#include "Components/Movement/SCTargetingSubsystem.h"
+#include "Components/Movement/SCRotationComponent.h"
+#include "Engine/Level.h"
+#include "Engine/World.h"
+#include "EngineUtils.h"
+#include "GameFramework/Actor.h"
+
+namespace SCTargetingSubsystem {
+/** Edge length of a spatial hash cell on the XY plane. */
+constexpr double CellSize = 2000.0;
+/** Most seeker queries run in one tick. */
+constexpr int32 MaxQueriesPerTick = 32;
+/** Most candidates of one pool whose location is refreshed in one tick. */
+constexpr int32 MaxRefreshesPerTick = 256;
+
+FIntPoint GetCellKey(const FVector &Location) {
+  return FIntPoint(FMath::FloorToInt32(Location.X / CellSize),
+                   FMath::FloorToInt32(Location.Y / CellSize));
+}
+
+bool Matches(const AActor &Actor, TSubclassOf<AActor> Class, FName Tag) {
+  return (!Class || Actor.IsA(Class)) &&
+         (Tag.IsNone() || Actor.ActorHasTag(Tag));
+}
+} // namespace SCTargetingSubsystem
+
+void USCTargetingSubsystem::Tick(float DeltaTime) {
+  Super::Tick(DeltaTime);
+
+  RemovePending();
+  AddPendingActors();
+
+  const int32 NumSeekers = Seekers.Num();
+  if (NumSeekers == 0) {
+    return;
+  }
+
+  for (FCandidatePool &Pool : Pools) {
+    UpdatePool(Pool);
+  }
+
+  const double Now = GetWorld()->GetTimeSeconds();
+  int32 NumQueries = 0;
+  for (int32 Step = 0; Step < NumSeekers &&
+                       NumQueries < SCTargetingSubsystem::MaxQueriesPerTick;
+       ++Step) {
+    const int32 Index = (QueryCursor + Step) % NumSeekers;
+    USCRotationComponent *Seeker = Seekers[Index];
+    if (NextQueryTimes[Index] > Now || !IsValid(Seeker)) {
+      continue;
+    }
+
+    Seeker->TargetActor = FindBestCandidate(Pools[SeekerPools[Index]], *Seeker);
+    NextQueryTimes[Index] = Now + Seeker->AutoTargetInterval;
+    QueryCursor = Index + 1;
+    ++NumQueries;
+  }
+}
+
+TStatId USCTargetingSubsystem::GetStatId() const {
+  RETURN_QUICK_DECLARE_CYCLE_STAT(USCTargetingSubsystem, STATGROUP_Tickables);
+}
+
+void USCTargetingSubsystem::Deinitialize() {
+  for (USCRotationComponent *Seeker : Seekers) {
+    if (Seeker) {
+      Seeker->SeekerIndex = INDEX_NONE;
+    }
+  }
+
+  if (ActorSpawnedHandle.IsValid()) {
+    GetWorld()->RemoveOnActorSpawnedHandler(ActorSpawnedHandle);
+    ActorSpawnedHandle.Reset();
+  }
+  if (LevelAddedHandle.IsValid()) {
+    FWorldDelegates::LevelAddedToWorld.Remove(LevelAddedHandle);
+    LevelAddedHandle.Reset();
+  }
+
+  Seekers.Reset();
+  SeekerPools.Reset();
+  NextQueryTimes.Reset();
+  Pools.Reset();
+  PendingActors.Reset();
+
+  Super::Deinitialize();
+}
+
+void USCTargetingSubsystem::AddSeeker(USCRotationComponent *Component) {
+  if (!Component || Component->SeekerIndex != INDEX_NONE) {
+    return;
+  }
+
+  Component->SeekerIndex = Seekers.Add(Component);
+  SeekerPools.Add(
+      FindOrAddPool(Component->AutoTargetClass, Component->AutoTargetTag));
+  NextQueryTimes.Add(0.0);
+}
+
+void USCTargetingSubsystem::RemoveSeeker(USCRotationComponent *Component) {
+  if (!Component || Component->SeekerIndex == INDEX_NONE) {
+    return;
+  }
+
+  Seekers[Component->SeekerIndex] = nullptr;
+  Component->SeekerIndex = INDEX_NONE;
+}
+
+void USCTargetingSubsystem::RefreshCandidate(AActor *Actor) {
+  if (Actor && Pools.Num() > 0) {
+    PendingActors.Add(Actor);
+  }
+}
+
+int32 USCTargetingSubsystem::FindOrAddPool(TSubclassOf<AActor> Class,
+                                           FName Tag) {
+  const int32 Existing = Pools.IndexOfByPredicate(
+      [Class, Tag](const FCandidatePool &Pool) {
+        return Pool.Class == Class && Pool.Tag == Tag;
+      });
+  if (Existing != INDEX_NONE) {
+    return Existing;
+  }
+
+  UWorld *World = GetWorld();
+  if (!ActorSpawnedHandle.IsValid()) {
+    ActorSpawnedHandle = World->AddOnActorSpawnedHandler(
+        FOnActorSpawned::FDelegate::CreateUObject(
+            this, &USCTargetingSubsystem::OnActorSpawned));
+  }
+  // Streamed levels and World Partition cells add their actors without
+  // spawning them.
+  if (!LevelAddedHandle.IsValid()) {
+    LevelAddedHandle = FWorldDelegates::LevelAddedToWorld.AddUObject(
+        this, &USCTargetingSubsystem::OnLevelAdded);
+  }
+
+  const int32 Index = Pools.AddDefaulted();
+  FCandidatePool &Pool = Pools[Index];
+  Pool.Class = Class;
+  Pool.Tag = Tag;
+  for (TActorIterator<AActor> It(World, Class ? *Class : AActor::StaticClass());
+       It; ++It) {
+    if (SCTargetingSubsystem::Matches(**It, Class, Tag)) {
+      AddCandidate(Pool, *It);
+    }
+  }
+  return Index;
+}
+
+void USCTargetingSubsystem::AddCandidate(FCandidatePool &Pool, AActor *Actor) {
+  const FVector Location = Actor->GetActorLocation();
+  const FIntPoint Key = SCTargetingSubsystem::GetCellKey(Location);
+  const int32 Index = Pool.Actors.Add(Actor);
+  Pool.Cells.FindOrAdd(Key).Add(Index);
+  Pool.Members.Add(Actor, Index);
+  Pool.Locations.Add(Location);
+  Pool.CellKeys.Add(Key);
+}
+
+void USCTargetingSubsystem::RemoveCandidate(FCandidatePool &Pool,
+                                            int32 Index) {
+  TArray<int32> &Cell = Pool.Cells.FindChecked(Pool.CellKeys[Index]);
+  Cell.RemoveSingleSwap(Index);
+  if (Cell.Num() == 0) {
+    Pool.Cells.Remove(Pool.CellKeys[Index]);
+  }
+
+  Pool.Members.Remove(Pool.Actors[Index]);
+  const int32 Last = Pool.Actors.Num() - 1;
+  if (Index != Last) {
+    TArray<int32> &LastCell = Pool.Cells.FindChecked(Pool.CellKeys[Last]);
+    LastCell[LastCell.Find(Last)] = Index;
+    Pool.Members.Add(Pool.Actors[Last], Index);
+  }
+
+  Pool.Actors.RemoveAtSwap(Index);
+  Pool.Locations.RemoveAtSwap(Index);
+  Pool.CellKeys.RemoveAtSwap(Index);
+}
+
+void USCTargetingSubsystem::UpdatePool(FCandidatePool &Pool) {
+  const int32 NumRefreshes = FMath::Min(
+      Pool.Actors.Num(), SCTargetingSubsystem::MaxRefreshesPerTick);
+  for (int32 Step = 0; Step < NumRefreshes && Pool.Actors.Num() > 0;
+       ++Step) {
+    if (Pool.RefreshCursor >= Pool.Actors.Num()) {
+      Pool.RefreshCursor = 0;
+    }
+    const int32 Index = Pool.RefreshCursor++;
+    const AActor *Actor = Pool.Actors[Index].Get();
+    if (!IsValid(Actor)) {
+      // The last candidate moves into this slot; refresh it next
+      RemoveCandidate(Pool, Index);
+      Pool.RefreshCursor = Index;
+      continue;
+    }
+
+    const FVector Location = Actor->GetActorLocation();
+    const FIntPoint Key = SCTargetingSubsystem::GetCellKey(Location);
+    Pool.Locations[Index] = Location;
+    if (Key == Pool.CellKeys[Index]) {
+      continue;
+    }
+
+    TArray<int32> &OldCell = Pool.Cells.FindChecked(Pool.CellKeys[Index]);
+    OldCell.RemoveSingleSwap(Index);
+    if (OldCell.Num() == 0) {
+      Pool.Cells.Remove(Pool.CellKeys[Index]);
+    }
+    Pool.Cells.FindOrAdd(Key).Add(Index);
+    Pool.CellKeys[Index] = Key;
+  }
+}
+
+AActor *USCTargetingSubsystem::FindBestCandidate(
+    const FCandidatePool &Pool, const USCRotationComponent &Seeker) const {
+  const FVector Origin = Seeker.GetComponentLocation();
+  const USceneComponent *Mount = Seeker.GetAttachParent();
+  const FVector Forward =
+      Mount ? Mount->GetForwardVector() : Seeker.GetForwardVector();
+  const double Radius = Seeker.AutoTargetRadius;
+  const double RadiusSquared = Radius * Radius;
+  const double MinCos =
+      FMath::Cos(FMath::DegreesToRadians(Seeker.AutoTargetConeAngle));
+  const bool bUseCone = Seeker.AutoTargetConeAngle < 180.0f;
+  const bool bNearest =
+      Seeker.AutoTargetSelection == ESCAutoTargetSelection::Nearest;
+  const AActor *Owner = Seeker.GetOwner();
+
+  AActor *Best = nullptr;
+  double BestScore = TNumericLimits<double>::Max();
+  auto Consider = [&](int32 Index) {
+    const FVector Delta = Pool.Locations[Index] - Origin;
+    const double DistanceSquared = Delta.SizeSquared();
+    if (DistanceSquared > RadiusSquared) {
+      return;
+    }
+
+    double Score = DistanceSquared;
+    if (bUseCone || !bNearest) {
+      const double Cos = DistanceSquared > UE_DOUBLE_SMALL_NUMBER
+                             ? (Delta | Forward) / FMath::Sqrt(DistanceSquared)
+                             : 1.0;
+      if (Cos < MinCos) {
+        return;
+      }
+      if (!bNearest) {
+        Score = -Cos;
+      }
+    }
+
+    AActor *Actor = Pool.Actors[Index].Get();
+    if (Score < BestScore && Actor && Actor != Owner) {
+      Best = Actor;
+      BestScore = Score;
+    }
+  };
+
+  const FIntPoint Min =
+      SCTargetingSubsystem::GetCellKey(Origin - FVector(Radius));
+  const FIntPoint Max =
+      SCTargetingSubsystem::GetCellKey(Origin + FVector(Radius));
+  const int64 NumCells =
+      int64(Max.X - Min.X + 1) * int64(Max.Y - Min.Y + 1);
+  if (NumCells > Pool.Cells.Num()) {
+    for (const TPair<FIntPoint, TArray<int32>> &Cell : Pool.Cells) {
+      if (Cell.Key.X >= Min.X && Cell.Key.X <= Max.X &&
+          Cell.Key.Y >= Min.Y && Cell.Key.Y <= Max.Y) {
+        for (const int32 Index : Cell.Value) {
+          Consider(Index);
+        }
+      }
+    }
+    return Best;
+  }
+
+  for (int32 X = Min.X; X <= Max.X; ++X) {
+    for (int32 Y = Min.Y; Y <= Max.Y; ++Y) {
+      if (const TArray<int32> *Cell = Pool.Cells.Find(FIntPoint(X, Y))) {
+        for (const int32 Index : *Cell) {
+          Consider(Index);
+        }
+      }
+    }
+  }
+  return Best;
+}
+
+void USCTargetingSubsystem::AddPendingActors() {
+  for (const TWeakObjectPtr<AActor> &Pending : PendingActors) {
+    AActor *Actor = Pending.Get();
+    if (!IsValid(Actor)) {
+      continue;
+    }
+    for (FCandidatePool &Pool : Pools) {
+      const bool bMatches =
+          SCTargetingSubsystem::Matches(*Actor, Pool.Class, Pool.Tag);
+      const int32 *Index = Pool.Members.Find(Pending);
+      if (bMatches && !Index) {
+        AddCandidate(Pool, Actor);
+      } else if (!bMatches && Index) {
+        RemoveCandidate(Pool, *Index);
+      }
+    }
+  }
+  PendingActors.Reset();
+}
+
+void USCTargetingSubsystem::OnActorSpawned(AActor *Actor) {
+  PendingActors.Add(Actor);
+}
+
+void USCTargetingSubsystem::OnLevelAdded(ULevel *Level, UWorld *World) {
+  if (!Level || World != GetWorld() || Pools.Num() == 0) {
+    return;
+  }
+  for (AActor *Actor : Level->Actors) {
+    if (Actor) {
+      PendingActors.Add(Actor);
+    }
+  }
+}
+
+void USCTargetingSubsystem::RemovePending() {
+  for (int32 Index = Seekers.Num() - 1; Index >= 0; --Index) {
+    if (IsValid(Seekers[Index])) {
+      continue;
+    }
+    if (Seekers[Index]) {
+      Seekers[Index]->SeekerIndex = INDEX_NONE;
+    }
+
+    Seekers.RemoveAtSwap(Index);
+    SeekerPools.RemoveAtSwap(Index);
+    NextQueryTimes.RemoveAtSwap(Index);
+    if (Seekers.IsValidIndex(Index)) {
+      Seekers[Index]->SeekerIndex = Index;
+    }
+  }
+}
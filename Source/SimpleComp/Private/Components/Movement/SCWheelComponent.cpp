@@ -6,6 +6,7 @@ USCWheelComponent::USCWheelComponent()
 	PrimaryComponentTick.bCanEverTick = true;
 	PrimaryComponentTick.bStartWithTickEnabled = true;
 	bTickInEditor = false;
+	bWantsOnUpdateTransform = true;
 }
 
 void USCWheelComponent::BeginPlay()
@@ -14,9 +15,22 @@ void USCWheelComponent::BeginPlay()
 	LastLocation = GetComponentLocation();
 }
 
-void USCWheelComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
+void USCWheelComponent::OnUpdateTransform(EUpdateTransformFlags UpdateTransformFlags, ETeleportType Teleport)
 {
-	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+	Super::OnUpdateTransform(UpdateTransformFlags, Teleport);
+
+	if (HasBegunPlay() && !IsComponentTickEnabled())
+	{
+		SignificanceState.Reset();
+		SetComponentTickEnabled(true);
+	}
+}
+
+void USCWheelComponent::TickComponent(float TickDeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
+{
+	Super::TickComponent(TickDeltaTime, TickType, ThisTickFunction);
+
+	const float DeltaTime = SignificanceState.Update(*this, Significance, TickDeltaTime);
 
 	AActor* Owner = GetOwner();
 	if (!Owner || DeltaTime <= 0.0f) return;
@@ -59,5 +73,9 @@ void USCWheelComponent::TickComponent(float DeltaTime, ELevelTick TickType, FAct
 		FQuat RollQuat = FQuat(FVector::RightVector, FMath::DegreesToRadians(-CurrentRollRotation));
 		SetRelativeRotation(SteerQuat * RollQuat);
 	}
+	else
+	{
+		SetComponentTickEnabled(false);
+	}
 	LastLocation = CurrentLocation;
 }
\ No newline at end of file
@@ -0,0 +1,126 @@
+#include "Core/SCAxisConstraint.h"
+
+namespace SCAxisConstraint {
+/**
+ * Splits a rotation into Twist * Swing, with the twist about Z and the swing
+ * about an axis in the XY plane, and writes the tangents of the quarter
+ * angles of the twist (yaw) and of the swing's Y (pitch) and X (roll)
+ * components. All coordinates lie in [-1, 1]. The split is only undefined
+ * for rotations that turn Z upside down.
+ */
+void Decompose(const FQuat &Rotation, double (&OutCoords)[3]) {
+  const double Sign = Rotation.W < 0.0 ? -1.0 : 1.0;
+  const double W = Rotation.W * Sign;
+  const double X = Rotation.X * Sign;
+  const double Y = Rotation.Y * Sign;
+  const double Z = Rotation.Z * Sign;
+
+  // Twist is (0, 0, Z, W) / N; the swing's W is N
+  const double N = FMath::Sqrt(W * W + Z * Z);
+  if (N < UE_DOUBLE_SMALL_NUMBER) {
+    OutCoords[0] = 0.0;
+    OutCoords[1] = Y;
+    OutCoords[2] = X;
+    return;
+  }
+
+  const double SwingScale = 1.0 / (N * (1.0 + N));
+  OutCoords[0] = Z / (N + W);
+  OutCoords[1] = (W * Y - Z * X) * SwingScale;
+  OutCoords[2] = (W * X + Z * Y) * SwingScale;
+}
+
+FQuat Compose(const double (&Coords)[3]) {
+  const double TwistSq = Coords[0] * Coords[0];
+  const double TwistScale = 1.0 / (1.0 + TwistSq);
+  const double TW = (1.0 - TwistSq) * TwistScale;
+  const double TZ = 2.0 * Coords[0] * TwistScale;
+
+  const double SwingSq = Coords[1] * Coords[1] + Coords[2] * Coords[2];
+  const double SwingScale = 1.0 / (1.0 + SwingSq);
+  const double SW = (1.0 - SwingSq) * SwingScale;
+  const double SY = 2.0 * Coords[1] * SwingScale;
+  const double SX = 2.0 * Coords[2] * SwingScale;
+
+  return FQuat(TW * SX - TZ * SY, TW * SY + TZ * SX, TZ * SW, TW * SW);
+}
+
+bool SameSettings(const FSCAxisSettings &A, const FSCAxisSettings &B) {
+  return A.Mode == B.Mode && A.Min == B.Min && A.Max == B.Max;
+}
+
+/** Returns the coordinate of a rotation of Degrees about the given axis,
+ * decomposed like any rotation so its sign matches FRotator. */
+double LimitCoordinate(int32 Axis, float Degrees) {
+  const double Angle = FMath::Clamp(double(Degrees), -180.0, 180.0);
+  const FRotator Rotator(Axis == 1 ? Angle : 0.0, Axis == 0 ? Angle : 0.0,
+                         Axis == 2 ? Angle : 0.0);
+  double Coords[3];
+  Decompose(Rotator.Quaternion(), Coords);
+  return Coords[Axis];
+}
+} // namespace SCAxisConstraint
+
+void FSCAxisConstraint::Update(const FSCAxisSettings &Pitch,
+                                     const FSCAxisSettings &Yaw,
+                                     const FSCAxisSettings &Roll) {
+  const FSCAxisSettings *NewSettings[NumAxes] = {&Yaw, &Pitch, &Roll};
+  if (bInitialized && SCAxisConstraint::SameSettings(Settings[0], Yaw) &&
+      SCAxisConstraint::SameSettings(Settings[1], Pitch) &&
+      SCAxisConstraint::SameSettings(Settings[2], Roll)) {
+    return;
+  }
+
+  bInitialized = true;
+  bAllFree = true;
+  bHasLockedAxis = false;
+  for (int32 Axis = 0; Axis < NumAxes; ++Axis) {
+    Settings[Axis] = *NewSettings[Axis];
+    Modes[Axis] = Settings[Axis].Mode;
+    bAllFree &= Modes[Axis] == ESCAxisMode::Free;
+    bHasLockedAxis |= Modes[Axis] == ESCAxisMode::Locked;
+    if (Modes[Axis] == ESCAxisMode::Limited) {
+      const double Min =
+          SCAxisConstraint::LimitCoordinate(Axis, Settings[Axis].Min);
+      const double Max =
+          SCAxisConstraint::LimitCoordinate(Axis, Settings[Axis].Max);
+      Lower[Axis] = FMath::Min(Min, Max);
+      Upper[Axis] = FMath::Max(Min, Max);
+    }
+  }
+}
+
+FQuat FSCAxisConstraint::Apply(const FQuat &Rotation,
+                                     const FQuat &Reference) const {
+  if (bAllFree) {
+    return Rotation;
+  }
+
+  double Coords[NumAxes];
+  SCAxisConstraint::Decompose(Rotation, Coords);
+
+  double ReferenceCoords[NumAxes] = {0.0, 0.0, 0.0};
+  if (bHasLockedAxis) {
+    SCAxisConstraint::Decompose(Reference, ReferenceCoords);
+  }
+
+  bool bChanged = false;
+  for (int32 Axis = 0; Axis < NumAxes; ++Axis) {
+    double Coord = Coords[Axis];
+    switch (Modes[Axis]) {
+    case ESCAxisMode::Locked:
+      Coord = ReferenceCoords[Axis];
+      break;
+    case ESCAxisMode::Limited:
+      Coord = FMath::Clamp(Coord, Lower[Axis], Upper[Axis]);
+      break;
+    case ESCAxisMode::Free:
+    default:
+      break;
+    }
+    bChanged |= Coord != Coords[Axis];
+    Coords[Axis] = Coord;
+  }
+
+  return bChanged ? SCAxisConstraint::Compose(Coords) : Rotation;
+}
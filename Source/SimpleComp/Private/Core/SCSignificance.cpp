@@ -0,0 +1,114 @@
+#include "Core/SCSignificance.h"
+#include "Camera/PlayerCameraManager.h"
+#include "Components/SceneComponent.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+#include "GameFramework/PlayerController.h"
+
+namespace SCSignificance {
+constexpr double NoViewerDistance = 1.0e7;
+
+FVector GetLocation(const UActorComponent &Component) {
+  const AActor *Owner = Component.GetOwner();
+  const USceneComponent *SceneComponent = Cast<USceneComponent>(&Component);
+  return SceneComponent ? SceneComponent->GetComponentLocation()
+         : Owner        ? Owner->GetActorLocation()
+                        : FVector::ZeroVector;
+}
+
+/** Converts world seconds since the last update to the owner's game time. */
+float GetElapsed(const UActorComponent &Component, double WorldSeconds) {
+  const AActor *Owner = Component.GetOwner();
+  const float Dilation = Owner ? Owner->CustomTimeDilation : 1.0f;
+  return static_cast<float>(WorldSeconds) * Dilation;
+}
+} // namespace SCSignificance
+
+float FSCSignificanceSettings::ComputeTickInterval(
+    const UWorld *World, const AActor *Owner, const FVector &Location) const {
+  double MinDistanceSquared = FMath::Square(SCSignificance::NoViewerDistance);
+  if (World) {
+    for (FConstPlayerControllerIterator It =
+             World->GetPlayerControllerIterator();
+         It; ++It) {
+      const APlayerController *Controller = It->Get();
+      if (Controller && Controller->IsLocalController() &&
+          Controller->PlayerCameraManager) {
+        MinDistanceSquared = FMath::Min(
+            MinDistanceSquared,
+            FVector::DistSquared(
+                Controller->PlayerCameraManager->GetCameraLocation(),
+                Location));
+      }
+    }
+  }
+
+  float Interval = TickIntervalByDistance.GetRichCurveConst()->Eval(
+      static_cast<float>(FMath::Sqrt(MinDistanceSquared)), 0.0f);
+
+  if (Owner && !Owner->WasRecentlyRendered(RecentlyRenderedTolerance)) {
+    Interval = FMath::Max(Interval, NotRenderedTickInterval);
+  }
+  return FMath::Max(Interval, 0.0f);
+}
+
+float FSCSignificanceState::Update(UActorComponent &Component,
+                                   const FSCSignificanceSettings &Settings,
+                                   float DeltaTime) {
+  if (!Settings.bEnabled) {
+    if (TickInterval != 0.0f) {
+      Component.SetComponentTickInterval(0.0f);
+      TickInterval = 0.0f;
+    }
+    LastUpdateTime = -1.0;
+    return DeltaTime;
+  }
+
+  const UWorld *World = Component.GetWorld();
+  if (!World) {
+    return DeltaTime;
+  }
+
+  const double Now = World->GetTimeSeconds();
+  const float Elapsed = LastUpdateTime >= 0.0
+                            ? SCSignificance::GetElapsed(
+                                  Component, Now - LastUpdateTime)
+                            : DeltaTime;
+  LastUpdateTime = Now;
+
+  const float NewInterval = Settings.ComputeTickInterval(
+      World, Component.GetOwner(), SCSignificance::GetLocation(Component));
+  if (!FMath::IsNearlyEqual(NewInterval, TickInterval)) {
+    Component.SetComponentTickInterval(NewInterval);
+    TickInterval = NewInterval;
+  }
+
+  return Elapsed;
+}
+
+float FSCSignificanceState::UpdateBatched(
+    const UActorComponent &Component, const FSCSignificanceSettings &Settings,
+    float DeltaTime) {
+  const UWorld *World = Component.GetWorld();
+  if (!Settings.bEnabled || !World) {
+    LastUpdateTime = -1.0;
+    NextBatchedUpdateTime = -1.0;
+    return DeltaTime;
+  }
+
+  const double Now = World->GetTimeSeconds();
+  if (Now < NextBatchedUpdateTime) {
+    return 0.0f;
+  }
+
+  const float Elapsed = LastUpdateTime >= 0.0
+                            ? SCSignificance::GetElapsed(
+                                  Component, Now - LastUpdateTime)
+                            : DeltaTime;
+  LastUpdateTime = Now;
+  NextBatchedUpdateTime =
+      Now + Settings.ComputeTickInterval(
+                World, Component.GetOwner(),
+                SCSignificance::GetLocation(Component));
+  return Elapsed;
+}
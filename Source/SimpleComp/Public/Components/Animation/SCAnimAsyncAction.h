@@ -11,9 +11,22 @@ DECLARE_DYNAMIC_MULTICAST_DELEGATE_ThreeParams(FSCAnimProxyOutputPin, FName,
                                                NotifyName, double, CurrentTime,
                                                double, NormalizedTime);
 
+/** Input exec pins of UK2Node_PlaySCAnimation, dispatched by RunCommand. */
+UENUM()
+enum class ESCAnimProxyCommand : uint8 {
+  Play,
+  PlayFromStart,
+  Stop,
+  Pause,
+  Resume,
+  ReverseFromEnd,
+  ReverseFromCurrent
+};
+
 /**
  * Proxy object that handles delegate binding and state for the
- * UK2Node_PlaySCAnimation.
+ * UK2Node_PlaySCAnimation. Each node instance keeps a single proxy in a
+ * persistent variable and reuses it for every input pin.
  */
 UCLASS(BlueprintType, meta = (DisplayName = "Simple Animation Async Action"))
 class SIMPLECOMP_API USCAnimAsyncAction : public UBlueprintAsyncActionBase {
@@ -22,12 +35,28 @@ class SIMPLECOMP_API USCAnimAsyncAction : public UBlueprintAsyncActionBase {
 public:
   virtual void Activate() override;
 
-  /** Internal factory for UK2Node */
+  /** Internal factory for UK2Node. SoftSequence is streamed in and played
+   * when Sequence is null. */
   // Use double for Blueprint interface (UE5 "Real" / Green Pins)
   UFUNCTION(BlueprintCallable, meta = (BlueprintInternalUseOnly = "true"))
-  static USCAnimAsyncAction *CreateProxy(USCCurveAnimComponent *Component,
-                                         USCAnimSequence *Sequence,
-                                         double Duration, bool bLoop);
+  static USCAnimAsyncAction *
+  CreateProxy(USCCurveAnimComponent *Component, USCAnimSequence *Sequence,
+              TSoftObjectPtr<USCAnimSequence> SoftSequence, double Duration,
+              bool bLoop);
+
+  /** Returns Existing configured with the given inputs, or a new proxy bound
+   * to Component if Existing is null. bCreated tells the node when to bind its
+   * output events. */
+  UFUNCTION(BlueprintCallable, meta = (BlueprintInternalUseOnly = "true"))
+  static USCAnimAsyncAction *
+  GetOrCreateProxy(USCAnimAsyncAction *Existing,
+                   USCCurveAnimComponent *Component, USCAnimSequence *Sequence,
+                   TSoftObjectPtr<USCAnimSequence> SoftSequence,
+                   double Duration, bool bLoop, bool &bCreated);
+
+  /** Runs the action of one of the node's input exec pins. */
+  UFUNCTION(BlueprintCallable, meta = (BlueprintInternalUseOnly = "true"))
+  void RunCommand(ESCAnimProxyCommand Command);
 
   /** Play control functions called by UK2Node */
   UFUNCTION(BlueprintCallable, meta = (BlueprintInternalUseOnly = "true"))
@@ -67,22 +96,27 @@ public:
   bool TargetLoop = false;
 
 private:
-  UFUNCTION()
   void HandleUpdate(float CurrentTime, float NormalizedTime);
-
-  UFUNCTION()
   void HandleFinished();
-
-  UFUNCTION()
   void HandleNotify(FName NotifyName);
 
+  void BindToComponent(USCCurveAnimComponent *Component);
   void Cleanup();
 
+  /** False while the component plays a sequence other than this action's. */
+  bool IsTrackingComponent() const;
+
+  /** Sequence this action plays, or null while it is still streaming in. */
+  USCAnimSequence *GetExpectedSequence() const;
+
   UPROPERTY()
   TObjectPtr<USCCurveAnimComponent> TargetComponent;
 
   UPROPERTY()
   TObjectPtr<USCAnimSequence> TargetSequence;
 
+  UPROPERTY()
+  TSoftObjectPtr<USCAnimSequence> TargetSoftSequence;
+
   float TargetDuration;
 };
@@ -0,0 +1,45 @@
+#pragma once
+
+#include "Components/Animation/SCAnimEvalPlan.h"
+#include "CoreMinimal.h"
+
+/**
+ * Frame-scoped cache of evaluated channel values, shared by components that
+ * play the same sequence in sync. Entries are keyed by sequence, evaluation
+ * version and reference time quantized to TimeStep; cached values are sampled
+ * at the quantized time. The cache is emptied on the first lookup of every
+ * frame. Game thread only.
+ */
+class SIMPLECOMP_API FSCAnimEvalCache {
+public:
+  /** Quantization step of cached reference times, in seconds. */
+  static constexpr float TimeStep = 0.0001f;
+
+  /** Returns the plan's values at the given reference time, evaluating them
+   * only if no other caller requested the same sample this frame. */
+  static FSCAnimChannelValues Evaluate(const FSCAnimEvalPlan &Plan,
+                                       float Time);
+
+private:
+  struct FKey {
+    const USCAnimSequence *Sequence = nullptr;
+    uint32 Version = 0;
+    int32 QuantizedTime = 0;
+
+    bool operator==(const FKey &Other) const {
+      return Sequence == Other.Sequence && Version == Other.Version &&
+             QuantizedTime == Other.QuantizedTime;
+    }
+
+    friend uint32 GetTypeHash(const FKey &Key) {
+      return HashCombine(
+          HashCombine(::GetTypeHash(Key.Sequence), ::GetTypeHash(Key.Version)),
+          ::GetTypeHash(Key.QuantizedTime));
+    }
+  };
+
+  static FSCAnimEvalCache &Get();
+
+  uint64 Frame = 0;
+  TMap<FKey, FSCAnimChannelValues> Entries;
+};
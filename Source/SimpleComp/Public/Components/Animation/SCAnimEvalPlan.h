@@ -0,0 +1,258 @@
+#pragma once
+
+#include "Core/SCTypes.h"
+#include "CoreMinimal.h"
+#include "Curves/CurveBase.h"
+#include "UObject/StrongObjectPtr.h"
+
+class USCAnimSequence;
+struct FRichCurve;
+struct FSCCurveTrack;
+struct FSCAnimBakedData;
+struct FSCAnimCompressedData;
+
+/**
+ * Transform channels an evaluation plan can write, in the order of the float
+ * entries of ESCCurveTrackType.
+ */
+namespace SCAnimChannel {
+enum Type : uint8 {
+  LocationX,
+  LocationY,
+  LocationZ,
+  RotationP,
+  RotationY,
+  RotationR,
+  ScaleX,
+  ScaleY,
+  ScaleZ,
+  Num
+};
+} // namespace SCAnimChannel
+
+/** A channel sampled from curve keys. */
+struct FSCAnimCurveOp {
+  const FRichCurve *Curve = nullptr;
+  float Scale = 1.0f;
+  uint8 Channel = 0;
+  /** 0 for the animating component, else 1 + bound target index. */
+  uint8 Target = 0;
+};
+
+/** A channel sampled from a baked table. */
+struct FSCAnimBakedOp {
+  int32 BakedChannel = INDEX_NONE;
+  float Scale = 1.0f;
+  uint8 Channel = 0;
+  uint8 Target = 0;
+};
+
+/** A channel sampled from compressed keys. */
+struct FSCAnimCompressedOp {
+  int32 CompressedChannel = INDEX_NONE;
+  float Scale = 1.0f;
+  uint8 Channel = 0;
+  uint8 Target = 0;
+};
+
+/**
+ * Up to four exact channels whose curves share key times, sampled together
+ * with 4-wide vector math. Each segment is stored as a cubic polynomial in
+ * the segment's normalized time with the channel scale folded in, so one key
+ * search and three multiply-adds sample every channel. Matches FRichCurve
+ * evaluation for curves accepted by CanBatch.
+ */
+struct SIMPLECOMP_API FSCAnimCurveBatch {
+  static constexpr int32 MaxChannels = 4;
+
+  /** True if the curve has keys, constant extrapolation and no weighted
+   * tangents. */
+  static bool CanBatch(const FRichCurve &Curve);
+
+  static bool HaveSameKeyTimes(const FRichCurve &A, const FRichCurve &B);
+
+  /** Resolves curves that pass CanBatch and share key times. Lane i of the
+   * result samples Curves[i] * Scales[i]. */
+  void Build(TArrayView<const FRichCurve *const> Curves,
+             TArrayView<const float> Scales);
+
+  /** Samples every lane at the given curve time. Unused lanes are zero. */
+  VectorRegister4Float Evaluate(float Time) const;
+
+  /** Plan channel written by each lane. */
+  uint8 Channels[MaxChannels] = {};
+  int32 NumChannels = 0;
+  /** 0 for the animating component, else 1 + bound target index. */
+  uint8 Target = 0;
+
+private:
+  TArray<float> KeyTimes;
+  /** Reciprocal length of each segment, or 0 for empty segments. */
+  TArray<float> InvDurations;
+  /** Four lanes each of the cubic, quadratic, linear and constant
+   * coefficients, per segment. */
+  TArray<float> Coefficients;
+  float FirstValues[MaxChannels] = {};
+  float LastValues[MaxChannels] = {};
+};
+
+/** A CustomFloat track resolved to a custom primitive data slot. The
+ * channel is sampled from whichever source is set. */
+struct FSCAnimCustomOp {
+  const FRichCurve *Curve = nullptr;
+  int32 BakedChannel = INDEX_NONE;
+  int32 CompressedChannel = INDEX_NONE;
+  float Scale = 1.0f;
+  int32 DataIndex = 0;
+  /** 0 for the animating component, else 1 + bound target index. */
+  uint8 Target = 0;
+};
+
+/** A scene component other than the animating one driven by a plan. */
+struct FSCAnimPlanTarget {
+  ESCAnimTargetType Type = ESCAnimTargetType::Component;
+  FName Name;
+  uint16 WriteMask = 0;
+  uint16 AdditiveMask = 0;
+};
+
+/** Raw channel values produced by a plan, before the base transform is
+ * applied. Only channels in the plan's write mask are meaningful. */
+struct FSCAnimChannelValues {
+  float Values[SCAnimChannel::Num];
+};
+
+/** A notify resolved into the plan's time-sorted table. */
+struct FSCAnimPlanNotify {
+  float Time = 0.0f;
+  FName Name;
+};
+
+/** Result of advancing a playback position by one update. */
+struct FSCAnimPlaybackStep {
+  /** Playback time before the update. */
+  float PrevTime = 0.0f;
+  /** Playback time after the update, within [0, Duration]. */
+  float Time = 0.0f;
+  /** +1 for forward playback, -1 for reverse. */
+  float Direction = 1.0f;
+  /** Number of times playback wrapped around a loop boundary. Can exceed one
+   * when a single update spans several loops. */
+  int32 NumWraps = 0;
+  /** True if a non-looping playback reached its end. */
+  bool bFinished = false;
+  /** Playback time past the end that a finishing update could not use. */
+  float Excess = 0.0f;
+};
+
+namespace SCAnimPlayback {
+/**
+ * Advances a playback time by DeltaTime * Rate in the given direction (+1 or
+ * -1), wrapping when looping and clamping otherwise. Pure and thread-safe.
+ */
+SIMPLECOMP_API FSCAnimPlaybackStep Advance(float Time, float DeltaTime,
+                                           float Rate, float Direction,
+                                           float Duration, bool bLoop);
+} // namespace SCAnimPlayback
+
+/**
+ * Resolved, allocation-free evaluation program for a USCAnimSequence.
+ * Tracks are flattened into per-channel ops that point directly at curve keys
+ * or at baked or compressed data. Exact channels sharing key times are
+ * grouped into curve batches. Channels overridden by a later track are
+ * dropped at build time, so each channel is sampled at most once per
+ * evaluation. Streamed curve assets the ops point into stay loaded until the
+ * plan is reset or rebuilt.
+ */
+struct SIMPLECOMP_API FSCAnimEvalPlan {
+  /** Resolves the tracks of a sequence. Passing null resets the plan. */
+  void Build(const USCAnimSequence *InSequence);
+
+  void Reset();
+
+  /** True if the plan was built from this sequence and it has not changed
+   * since. */
+  bool IsBuiltFor(const USCAnimSequence *InSequence) const;
+
+  /** Samples every resolved channel of the animating component at the
+   * given curve time. Safe to call from any thread while the sequence is
+   * alive and unchanged. */
+  void Evaluate(float Time, FSCAnimChannelValues &OutValues) const;
+
+  /** Samples the channels of every bound target. OutValues holds one entry
+   * per element of GetBoundTargets(). */
+  void EvaluateBound(float Time,
+                     TArrayView<FSCAnimChannelValues> OutValues) const;
+
+  /** Applies evaluated channels on top of a base transform. */
+  FTransform Compose(const FSCAnimChannelValues &Values,
+                     const FVector &BaseLocation, const FRotator &BaseRotation,
+                     const FVector &BaseScale) const;
+
+  /** Applies the evaluated channels of a bound target on top of its base
+   * transform. */
+  FTransform ComposeBound(int32 TargetIndex, const FSCAnimChannelValues &Values,
+                          const FTransform &Base) const;
+
+  /** Samples the first OutValues.Num() entries of GetCustomOps(). */
+  void EvaluateCustom(float Time, TArrayView<float> OutValues) const;
+
+  /** CustomFloat outputs, sorted by target and then by data index. */
+  const TArray<FSCAnimCustomOp> &GetCustomOps() const { return CustomOps; }
+
+  /** Number of leading custom ops that target the animating component. */
+  int32 GetNumSelfCustomOps() const { return NumSelfCustomOps; }
+
+  /** Components other than the animating one driven by the sequence, in the
+   * order of EvaluateBound's output. */
+  const TArray<FSCAnimPlanTarget> &GetBoundTargets() const {
+    return BoundTargets;
+  }
+
+  const USCAnimSequence *GetSequence() const { return Sequence; }
+
+  /** Length of the sequence in curve time, cached at build time. */
+  float GetReferenceDuration() const { return ReferenceDuration; }
+
+  /** Bit mask of the SCAnimChannel entries written by the plan. */
+  uint16 GetWriteMask() const { return WriteMask; }
+
+  /** Notifies of the sequence, sorted by time. */
+  const TArray<FSCAnimPlanNotify> &GetNotifies() const { return Notifies; }
+
+  /** Number of sorted notifies with Time <= the given time. */
+  int32 CountNotifiesAtOrBefore(float Time) const;
+
+  /** Number of sorted notifies with Time < the given time. */
+  int32 CountNotifiesBefore(float Time) const;
+
+private:
+  void AddCustomOp(const FSCCurveTrack &Track, int32 TrackIndex);
+  /** Keeps the track's soft curve asset loaded while the plan uses it. */
+  void PinSoftCurve(const FSCCurveTrack &Track);
+  /** Moves curve ops sharing key times into curve batches. */
+  void BuildCurveBatches();
+
+  const USCAnimSequence *Sequence = nullptr;
+  const FSCAnimBakedData *BakedData = nullptr;
+  const FSCAnimCompressedData *CompressedData = nullptr;
+  uint32 SequenceVersion = 0;
+  float ReferenceDuration = 0.0f;
+  uint16 WriteMask = 0;
+  uint16 AdditiveMask = 0;
+  TArray<FSCAnimCurveOp> CurveOps;
+  TArray<FSCAnimBakedOp> BakedOps;
+  TArray<FSCAnimCompressedOp> CompressedOps;
+  /** Ops of the animating component come first in each op array. */
+  int32 NumSelfCurveOps = 0;
+  int32 NumSelfBakedOps = 0;
+  int32 NumSelfCompressedOps = 0;
+  TArray<FSCAnimCurveBatch> CurveBatches;
+  int32 NumSelfCurveBatches = 0;
+  TArray<FSCAnimCustomOp> CustomOps;
+  int32 NumSelfCustomOps = 0;
+  TArray<FSCAnimPlanTarget> BoundTargets;
+  TArray<FSCAnimPlanNotify> Notifies;
+  /** Soft curve assets read by exact ops. */
+  TArray<TStrongObjectPtr<UCurveBase>> SoftCurves;
+};
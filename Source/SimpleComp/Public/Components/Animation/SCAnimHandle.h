@@ -0,0 +1,56 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "SCAnimHandle.generated.h"
+
+/**
+ * Identifies one playback started through USCCurveAnimComponent's handle
+ * API. A handle goes stale once its playback finishes, is stopped or is
+ * replaced by another play call, after which every operation on it is
+ * ignored.
+ */
+USTRUCT(BlueprintType)
+struct SIMPLECOMP_API FSCAnimHandle {
+  GENERATED_BODY()
+
+  /** Returns true if the handle was returned by a successful play call. It
+   * may still be stale. */
+  bool IsSet() const { return Generation != 0; }
+
+  bool operator==(const FSCAnimHandle &Other) const {
+    return Slot == Other.Slot && Generation == Other.Generation;
+  }
+
+  bool operator!=(const FSCAnimHandle &Other) const {
+    return !(*this == Other);
+  }
+
+  /** Index into the owning component's slot table. */
+  UPROPERTY()
+  int32 Slot = INDEX_NONE;
+
+  /** Generation of the slot when the handle was issued. */
+  UPROPERTY()
+  uint32 Generation = 0;
+};
+
+DECLARE_DELEGATE_TwoParams(FSCAnimHandleFinishedDelegate, FSCAnimHandle,
+                           bool /*bInterrupted*/);
+DECLARE_DELEGATE_TwoParams(FSCAnimHandleNotifyDelegate, FSCAnimHandle,
+                           FName /*NotifyName*/);
+DECLARE_DELEGATE_ThreeParams(FSCAnimHandleUpdateDelegate, FSCAnimHandle,
+                             float /*CurrentTime*/, float /*NormalizedTime*/);
+
+/**
+ * Native callbacks of a single handle. They are unbound when the handle
+ * goes stale, right after OnFinished has run.
+ */
+struct FSCAnimHandleDelegates {
+  /** Runs when the playback ends. bInterrupted is true if it was stopped or
+   * replaced before reaching its end. */
+  FSCAnimHandleFinishedDelegate OnFinished;
+
+  FSCAnimHandleNotifyDelegate OnNotify;
+
+  FSCAnimHandleUpdateDelegate OnUpdate;
+};
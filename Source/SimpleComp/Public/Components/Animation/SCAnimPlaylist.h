@@ -0,0 +1,77 @@
+#pragma once
+
+#include "Core/SCTypes.h"
+#include "CoreMinimal.h"
+#include "Engine/DataAsset.h"
+#include "SCAnimPlaylist.generated.h"
+
+class USCAnimSequence;
+
+/**
+ * A single sequence of a playlist.
+ */
+USTRUCT(BlueprintType)
+struct FSCAnimPlaylistEntry {
+  GENERATED_BODY()
+
+  UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Playlist")
+  TObjectPtr<USCAnimSequence> Sequence;
+
+  /** Duration of one play of the entry. 0 or less uses the sequence
+   * duration. */
+  UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Playlist")
+  float Duration = -1.0f;
+
+  /** Number of times the entry plays in a row each time it is picked. */
+  UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Playlist",
+            meta = (ClampMin = "1"))
+  int32 LoopCount = 1;
+
+  /** Relative chance of the entry being picked in random order. */
+  UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Playlist",
+            meta = (ClampMin = "0.0"))
+  float Weight = 1.0f;
+};
+
+/**
+ * DataAsset listing sequences that USCCurveAnimComponent::PlayPlaylist plays
+ * back to back, without Blueprint round trips between them.
+ */
+UCLASS(BlueprintType, meta = (DisplayName = "Simple Animation Playlist"))
+class SIMPLECOMP_API USCAnimPlaylist : public UDataAsset {
+  GENERATED_BODY()
+
+public:
+  UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SimpleComp|Animation")
+  TArray<FSCAnimPlaylistEntry> Entries;
+
+  UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SimpleComp|Animation")
+  ESCAnimPlaylistOrder Order = ESCAnimPlaylistOrder::Sequential;
+
+  /** Number of passes through the playlist. 0 repeats it until stopped. In
+   * random order, a pass is one pick per playable entry. */
+  UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SimpleComp|Animation",
+            meta = (ClampMin = "0"))
+  int32 LoopCount = 1;
+
+  /** In random order, never picks the entry that just played while another
+   * one can be picked. */
+  UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SimpleComp|Animation",
+            meta = (EditCondition = "Order == ESCAnimPlaylistOrder::Random"))
+  bool bAvoidRepeats = true;
+
+  /** Returns the number of entries that can be picked. */
+  int32 GetNumPlayableEntries() const;
+
+  /**
+   * Picks the entry to play after another one.
+   * @param Previous Entry that just played, or INDEX_NONE at the start.
+   * @return The next entry, or INDEX_NONE if no entry can be played.
+   */
+  int32 PickEntry(int32 Previous, FRandomStream &Random) const;
+
+private:
+  /** True if the entry has a sequence, a positive duration and, in random
+   * order, a positive weight. */
+  bool IsPlayable(int32 EntryIndex) const;
+};
@@ -2,23 +2,47 @@
 
 #include "Core/SCTypes.h"
 #include "CoreMinimal.h"
+#include "Curves/CurveFloat.h"
+#include "Curves/CurveVector.h"
 #include "Engine/DataAsset.h"
 #include "SCAnimSequence.generated.h"
 
 class UCurveBase;
-class UCurveFloat;
+struct FRichCurve;
 
 /**
  * Defines a single curve track within an animation sequence.
  */
 USTRUCT(BlueprintType)
-struct FSCCurveTrack {
+struct SIMPLECOMP_API FSCCurveTrack {
   GENERATED_BODY()
 
-  /** The curve asset to sample from. */
+  /** If true, the curve is stored inside the sequence instead of in a
+   * separate curve asset. */
   UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Track")
+  bool bInlineCurve = false;
+
+  /** The curve asset to sample from. */
+  UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Track",
+            meta = (EditCondition = "!bInlineCurve", EditConditionHides))
   TObjectPtr<UCurveBase> CurveAsset = nullptr;
 
+  /** Curve asset used when CurveAsset is unset. It is not loaded with the
+   * sequence; playback waits for it to be streamed in. */
+  UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Track",
+            meta = (EditCondition = "!bInlineCurve", EditConditionHides))
+  TSoftObjectPtr<UCurveBase> SoftCurveAsset;
+
+  /** Inline curve used by float track types. */
+  UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Track",
+            meta = (EditCondition = "bInlineCurve", EditConditionHides))
+  FRuntimeFloatCurve InlineFloatCurve;
+
+  /** Inline curve used by vector track types. */
+  UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Track",
+            meta = (EditCondition = "bInlineCurve", EditConditionHides))
+  FRuntimeVectorCurve InlineVectorCurve;
+
   /** What transform property this curve should drive. */
   UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Track")
   ESCCurveTrackType TrackType = ESCCurveTrackType::VectorLocation;
@@ -35,6 +59,57 @@ struct FSCCurveTrack {
   /** Scale factor for vector curves. */
   UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Track")
   FVector ScaleVector = FVector::OneVector;
+
+  /** Custom primitive data slot written by CustomFloat tracks. For
+   * instanced playback it is the per-instance custom data slot. */
+  UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Track",
+            meta = (EditCondition =
+                        "TrackType == ESCCurveTrackType::CustomFloat",
+                    EditConditionHides, ClampMin = "0"))
+  int32 CustomDataIndex = 0;
+
+  /** Scene component the track drives. Tracks bound to other components
+   * are evaluated in the same pass as the animating component's own and
+   * always drive their relative transform. CustomFloat tracks targeting
+   * Self write to the primitives attached directly to the animating
+   * component. Instanced playback and Sequencer only use tracks targeting
+   * Self. */
+  UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Target")
+  ESCAnimTargetType TargetType = ESCAnimTargetType::Self;
+
+  /** Component or socket name, depending on TargetType. */
+  UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Target",
+            meta = (EditCondition = "TargetType != ESCAnimTargetType::Self",
+                    EditConditionHides))
+  FName TargetName;
+
+  /** Channel count of the source curve when cooking stripped it because
+   * compressed keys replace it, or 0 if the track keeps its curve. */
+  UPROPERTY()
+  int32 StrippedNumChannels = 0;
+
+  /** Returns CurveAsset, or SoftCurveAsset if it is loaded. */
+  UCurveBase *GetCurveAsset() const;
+
+  /** Returns the number of scalar channels the curve provides (1 for float
+   * curves, 3 for vector curves, 0 if unset, unsupported or without keys).
+   * Inline curves follow the track type, stripped tracks report the count of
+   * their source curve. */
+  int32 GetNumChannels() const;
+
+  /** Returns the key data of a single channel, or null if out of range or
+   * stripped. Inline curves resolve to their external curve asset when one
+   * is set. */
+  const FRichCurve *GetChannelCurve(int32 Channel) const;
+
+  /** Returns the time range covered by the curve keys.
+   * @return False if the track has no keys. */
+  bool GetTimeRange(float &OutMinTime, float &OutMaxTime) const;
+
+  /** Copies the keys of the curve asset into the inline curve and clears the
+   * asset references.
+   * @return False if there is no asset or it does not match the track type. */
+  bool ConvertToInline();
 };
 
 /**
@@ -55,6 +130,150 @@ struct FSCAnimNotify {
   float Time = 0.0f;
 };
 
+/**
+ * Uniform-rate sample tables produced from the curve tracks of a sequence.
+ * Samples are stored channel by channel, each channel being one contiguous run
+ * of NumSamples values covering the sequence's reference duration.
+ */
+USTRUCT()
+struct SIMPLECOMP_API FSCAnimBakedData {
+  GENERATED_BODY()
+
+  /** Samples per second of reference time. */
+  UPROPERTY()
+  float SampleRate = 0.0f;
+
+  /** Number of samples stored per channel. */
+  UPROPERTY()
+  int32 NumSamples = 0;
+
+  /** First baked channel of each track, or INDEX_NONE if the track is evaluated
+   * exactly. */
+  UPROPERTY()
+  TArray<int32> TrackChannels;
+
+  /** Full precision samples. Empty when quantized. */
+  UPROPERTY()
+  TArray<float> Samples;
+
+  /** 16-bit samples. Empty when not quantized. */
+  UPROPERTY()
+  TArray<uint16> QuantizedSamples;
+
+  /** Per-channel offset used to decode quantized samples. */
+  UPROPERTY()
+  TArray<float> ChannelMin;
+
+  /** Per-channel step used to decode quantized samples. */
+  UPROPERTY()
+  TArray<float> ChannelStep;
+
+  bool IsValid() const { return NumSamples > 1; }
+
+  bool IsQuantized() const { return QuantizedSamples.Num() > 0; }
+
+  /** Returns the first baked channel of a track, or INDEX_NONE. */
+  int32 GetTrackChannel(int32 TrackIndex) const {
+    return TrackChannels.IsValidIndex(TrackIndex) ? TrackChannels[TrackIndex]
+                                                  : INDEX_NONE;
+  }
+
+  /** Samples a baked channel at the given reference time. */
+  float SampleChannel(int32 Channel, float Time) const;
+
+  void Reset();
+};
+
+/**
+ * Key-reduced curve data produced from the curve tracks of a sequence. Each
+ * channel is a run of linear keys placed on a uniform sample grid, with key
+ * times stored as grid indices and values quantized to 16 bits.
+ */
+USTRUCT()
+struct SIMPLECOMP_API FSCAnimCompressedData {
+  GENERATED_BODY()
+
+  /** Grid points per second of reference time. */
+  UPROPERTY()
+  float SampleRate = 0.0f;
+
+  /** First compressed channel of each track, or INDEX_NONE if the track is
+   * evaluated exactly. */
+  UPROPERTY()
+  TArray<int32> TrackChannels;
+
+  /** Index of the first key of each channel, plus a trailing end index. */
+  UPROPERTY()
+  TArray<int32> KeyOffsets;
+
+  /** Grid index of every key. */
+  UPROPERTY()
+  TArray<uint16> KeyTimes;
+
+  /** Quantized value of every key. */
+  UPROPERTY()
+  TArray<uint16> KeyValues;
+
+  /** Per-channel offset used to decode key values. */
+  UPROPERTY()
+  TArray<float> ChannelMin;
+
+  /** Per-channel step used to decode key values. */
+  UPROPERTY()
+  TArray<float> ChannelStep;
+
+  bool IsValid() const { return SampleRate > 0.0f; }
+
+  /** Returns the first compressed channel of a track, or INDEX_NONE. */
+  int32 GetTrackChannel(int32 TrackIndex) const {
+    return TrackChannels.IsValidIndex(TrackIndex) ? TrackChannels[TrackIndex]
+                                                  : INDEX_NONE;
+  }
+
+  /** Samples a compressed channel at the given reference time. */
+  float SampleChannel(int32 Channel, float Time) const;
+
+  /** Serialized size of the compressed data in bytes. */
+  int32 GetDataSize() const;
+
+  void Reset();
+};
+
+/**
+ * Outcome of the last key compression of a sequence. Cooking strips the
+ * source curves of compressed tracks, so their keys are replaced by the
+ * compressed data. Tracks kept exact still cook their source curves.
+ */
+USTRUCT(BlueprintType)
+struct FSCAnimCompressionReport {
+  GENERATED_BODY()
+
+  /** Source keys of the channels that were compressed. */
+  UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Compression")
+  int32 SourceKeys = 0;
+
+  /** Size of those source keys in bytes, stripped when cooking. Curve assets
+   * also referenced by other assets are still cooked for them. */
+  UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Compression")
+  int32 SourceBytes = 0;
+
+  /** Keys kept after reduction. */
+  UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Compression")
+  int32 CompressedKeys = 0;
+
+  /** Size of the compressed data in bytes. */
+  UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Compression")
+  int32 CompressedBytes = 0;
+
+  /** Net cooked size saved, SourceBytes minus CompressedBytes. */
+  UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Compression")
+  int32 SavedBytes = 0;
+
+  /** Tracks left exact because they could not meet the error tolerance. */
+  UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Compression")
+  int32 ExactTracks = 0;
+};
+
 /**
  * DataAsset containing reusable animation data for the SC Curve Animation
  * Component.
@@ -78,7 +297,140 @@ public:
             meta = (ClampMin = "0.01"))
   float DefaultDuration = 1.0f;
 
+  /** How curve tracks are sampled at runtime. Baked tables and compressed
+   * keys are generated at cook time, or on first play in uncooked builds. */
+  UPROPERTY(EditAnywhere, BlueprintReadOnly,
+            Category = "SimpleComp|Evaluation")
+  ESCAnimEvaluationMode EvaluationMode = ESCAnimEvaluationMode::Exact;
+
+  /** Number of baked samples per second of reference time. Compression uses
+   * it as the grid its keys are placed on. */
+  UPROPERTY(EditAnywhere, BlueprintReadOnly,
+            Category = "SimpleComp|Evaluation",
+            meta = (EditCondition =
+                        "EvaluationMode != ESCAnimEvaluationMode::Exact",
+                    ClampMin = "1.0", ClampMax = "1000.0", Units = "Hz"))
+  float BakeSampleRate = 60.0f;
+
+  /** Maximum allowed difference between baked or compressed values and exact
+   * values, per channel. Tracks exceeding it fall back to exact evaluation. */
+  UPROPERTY(EditAnywhere, BlueprintReadOnly,
+            Category = "SimpleComp|Evaluation",
+            meta = (EditCondition =
+                        "EvaluationMode != ESCAnimEvaluationMode::Exact",
+                    ClampMin = "0.0"))
+  float BakeErrorTolerance = 0.01f;
+
+  /** Stores baked samples as 16-bit values, halving their memory. */
+  UPROPERTY(EditAnywhere, BlueprintReadOnly,
+            Category = "SimpleComp|Evaluation",
+            meta = (EditCondition =
+                        "EvaluationMode == ESCAnimEvaluationMode::Baked"))
+  bool bQuantizeBakedSamples = false;
+
+  /** Result of the last key compression. */
+  UPROPERTY(VisibleAnywhere, Transient, BlueprintReadOnly,
+            Category = "SimpleComp|Evaluation")
+  FSCAnimCompressionReport CompressionReport;
+
+  /** Moves the keys of every track's curve asset into the sequence, removing
+   * the dependency on separate curve assets. */
+  UFUNCTION(BlueprintCallable, CallInEditor, Category = "SimpleComp|Animation")
+  void ConvertCurvesToInline();
+
   /** Returns all unique notify names defined in this sequence. */
   UFUNCTION(BlueprintPure, Category = "SimpleComp|Animation")
   TArray<FName> GetNotifyNames() const;
+
+  /** Asset registry tag listing the unique notify names, so tools can read
+   * them without loading the sequence. Names are separated by commas, with
+   * commas and backslashes inside names escaped by a backslash. */
+  static const FName NotifyNamesTag;
+
+  /** Parses the value of NotifyNamesTag back into notify names. */
+  static TArray<FName> ParseNotifyNamesTag(const FString &TagValue);
+
+  /** Returns the length of the sequence in curve time: DefaultDuration, or the
+   * end of the longest curve if no default is set. */
+  UFUNCTION(BlueprintPure, Category = "SimpleComp|Animation")
+  float GetReferenceDuration() const;
+
+  /**
+   * Samples a single track at the given curve time, using baked samples when
+   * available. Float tracks write only the X component.
+   * @return False if the track index is invalid or the track has no curve.
+   */
+  bool EvaluateTrack(int32 TrackIndex, float Time, FVector &OutValue) const;
+
+  /** Rebuilds the baked sample tables from the current curve tracks. The
+   * tables are only kept in memory; editor saves discard them and cooking
+   * rebuilds them. */
+  UFUNCTION(BlueprintCallable, Category = "SimpleComp|Evaluation")
+  void BakeSamples();
+
+  /** Discards baked samples. Playback falls back to exact evaluation. */
+  UFUNCTION(BlueprintCallable, Category = "SimpleComp|Evaluation")
+  void ClearBakedSamples();
+
+  /** Reduces the curve tracks to compressed keys and logs the memory saved.
+   * Like baked tables, the keys are only saved when cooking, which also
+   * strips the source curves they replace. Does nothing on a cooked sequence
+   * whose curves were stripped. */
+  UFUNCTION(BlueprintCallable, Category = "SimpleComp|Evaluation")
+  void CompressCurves();
+
+  /** Discards compressed keys. Playback falls back to exact evaluation.
+   * Does nothing on a cooked sequence whose curves were stripped. */
+  UFUNCTION(BlueprintCallable, Category = "SimpleComp|Evaluation")
+  void ClearCompressedCurves();
+
+  /** Bakes or compresses the curve tracks if the evaluation mode requires it
+   * and no data exists yet. */
+  void EnsureEvaluationData();
+
+  /** Returns the baked tables, or null if the sequence is not baked. */
+  const FSCAnimBakedData *GetBakedData() const;
+
+  /** Returns the compressed keys, or null if the sequence is not
+   * compressed. */
+  const FSCAnimCompressedData *GetCompressedData() const;
+
+  /** Appends the soft curve assets of the tracks that are not loaded yet. */
+  void GetUnloadedCurves(TArray<FSoftObjectPath> &OutPaths) const;
+
+  /** Invalidates cached evaluation data once soft curves were streamed in.
+   * Evaluation plans built afterwards keep the curves they use loaded. */
+  void NotifyCurvesLoaded();
+
+  /** Incremented whenever cached evaluation data derived from this sequence
+   * must be rebuilt. */
+  uint32 GetEvaluationVersion() const { return EvaluationVersion; }
+
+  virtual void Serialize(FArchive &Ar) override;
+  virtual void PreSave(FObjectPreSaveContext SaveContext) override;
+  virtual void
+  GetAssetRegistryTags(FAssetRegistryTagsContext Context) const override;
+#if WITH_EDITOR
+  virtual void
+  PostEditChangeProperty(FPropertyChangedEvent &PropertyChangedEvent) override;
+#endif
+
+private:
+  /** Discards baked and compressed data derived from the curve tracks. */
+  void InvalidateEvaluationData();
+
+  /** Returns true if cooking stripped the source curve of any track. */
+  bool HasStrippedCurves() const;
+
+  /** Drops the source curves of the tracks covered by compressed keys and
+   * freezes the reference duration they defined. */
+  void StripCompressedCurves();
+
+  UPROPERTY()
+  FSCAnimBakedData BakedData;
+
+  UPROPERTY()
+  FSCAnimCompressedData CompressedData;
+
+  uint32 EvaluationVersion = 1;
 };
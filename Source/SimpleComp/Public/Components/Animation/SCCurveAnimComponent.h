@@ -1,12 +1,23 @@
 #pragma once
 
+#include "Components/Animation/SCAnimEvalPlan.h"
+#include "Components/Animation/SCAnimHandle.h"
 #include "Components/SceneComponent.h"
+#include "Core/SCSignificance.h"
 #include "Core/SCTypes.h"
 #include "SCCurveAnimComponent.generated.h"
 
+class USCAnimPlaylist;
 class USCAnimSequence;
+struct FStreamableHandle;
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE(FSCAnimFinishedSignature);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE(FSCAnimPreloadedSignature);
+
+DECLARE_MULTICAST_DELEGATE(FSCAnimFinishedNativeSignature);
+DECLARE_MULTICAST_DELEGATE_OneParam(FSCAnimNotifyNativeSignature, FName);
+DECLARE_MULTICAST_DELEGATE_TwoParams(FSCAnimUpdateNativeSignature, float,
+                                     float);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FSCAnimNotifySignature, FName,
                                             NotifyName);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FSCAnimUpdateSignature, float,
@@ -28,9 +39,16 @@ public:
 
   virtual void BeginPlay() override;
 
+  virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
   UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SimpleComp|Animation")
   TObjectPtr<USCAnimSequence> AnimSequence;
 
+  /** Sequence streamed in and played by Play while AnimSequence is unset.
+   * Unlike AnimSequence it is not loaded together with the owner. */
+  UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SimpleComp|Animation")
+  TSoftObjectPtr<USCAnimSequence> SoftAnimSequence;
+
   UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SimpleComp|Animation",
             meta = (ClampMin = "0.01"))
   float PlaybackDuration = 1.0f;
@@ -50,6 +68,40 @@ public:
   UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SimpleComp|Animation")
   ESCTransformSpace TransformSpace = ESCTransformSpace::Local;
 
+  /** If true, playback is driven by the world's USCCurveAnimSubsystem, which
+   * advances and evaluates all opted-in components in parallel batches. The
+   * component's own tick stays disabled while registered. */
+  UPROPERTY(EditAnywhere, BlueprintReadOnly,
+            Category = "SimpleComp|Performance")
+  bool bUseBatchedEvaluation = false;
+
+  /** Distance and visibility based tick throttling. Not used while playback
+   * is driven by batched evaluation. */
+  UPROPERTY(EditAnywhere, BlueprintReadWrite,
+            Category = "SimpleComp|Performance")
+  FSCSignificanceSettings Significance;
+
+  /** If true, curve values are read from a frame-scoped cache shared with
+   * every other component sampling the same sequence at the same time this
+   * frame. Times are quantized to FSCAnimEvalCache::TimeStep. Meant for
+   * large groups started together; not used by batched evaluation. */
+  UPROPERTY(EditAnywhere, BlueprintReadWrite,
+            Category = "SimpleComp|Performance")
+  bool bUseSharedEvaluationCache = false;
+
+  /** If true, primitives with a kinematic body that are attached directly to
+   * this component, and bound primitive targets, receive the animated
+   * transform as a kinematic target instead of being moved. Physics moves the
+   * bodies there during its step, also with async physics, and the
+   * primitives follow their bodies, so no synchronous transform update or
+   * overlap test runs for them per tick. Driven children are detached from
+   * transform propagation while the option is set; this component and its
+   * other children move as usual. Scale channels do not affect driven
+   * bodies. */
+  UPROPERTY(EditAnywhere, BlueprintReadWrite,
+            Category = "SimpleComp|Performance")
+  bool bUseKinematicTarget = false;
+
   UPROPERTY(BlueprintAssignable, Category = "SimpleComp|Animation")
   FSCAnimFinishedSignature OnAnimationFinished;
 
@@ -59,11 +111,21 @@ public:
   UPROPERTY(BlueprintAssignable, Category = "SimpleComp|Animation")
   FSCAnimUpdateSignature OnAnimationUpdate;
 
+  /** Native counterparts of the events above, for C++ listeners. */
+  FSCAnimFinishedNativeSignature OnAnimationFinishedNative;
+  FSCAnimNotifyNativeSignature OnAnimationNotifyNative;
+  FSCAnimUpdateNativeSignature OnAnimationUpdateNative;
+
+  /** Broadcast once every sequence passed to PreloadSequences is resident. */
+  UPROPERTY(BlueprintAssignable, Category = "SimpleComp|Animation")
+  FSCAnimPreloadedSignature OnSequencesPreloaded;
+
   UFUNCTION(BlueprintCallable, Category = "SimpleComp|Animation")
   void Play();
 
   /**
-   * Plays the animation with extended options.
+   * Plays the animation with extended options. If the sequence still has
+   * soft curves to stream in, playback starts once they are loaded.
    * @param Sequence Optional sequence to play. If null, plays current.
    * @param Duration Duration to play for. -1 uses sequence duration.
    * @param bFromStart Whether to restart from beginning.
@@ -75,6 +137,77 @@ public:
               bool bFromStart = true, bool bReverse = false,
               bool bInLoop = false);
 
+  /**
+   * Like PlayEx, but streams the sequence in asynchronously first if it is
+   * not loaded yet.
+   */
+  UFUNCTION(BlueprintCallable, Category = "SimpleComp|Animation")
+  void PlaySoft(TSoftObjectPtr<USCAnimSequence> Sequence,
+                float Duration = -1.0f, bool bFromStart = true,
+                bool bReverse = false, bool bInLoop = false);
+
+  /** True while playback waits for a sequence or its curves to load. */
+  UFUNCTION(BlueprintPure, Category = "SimpleComp|Animation")
+  bool IsPlaybackPending() const;
+
+  /**
+   * Streams in the given sequences and their curves in the background and
+   * keeps them resident until ReleasePreloadedSequences is called. Replaces
+   * any previous preload request.
+   */
+  UFUNCTION(BlueprintCallable, Category = "SimpleComp|Animation")
+  void
+  PreloadSequences(const TArray<TSoftObjectPtr<USCAnimSequence>> &Sequences);
+
+  /** Drops the references held by PreloadSequences. Streamed curves then
+   * stay loaded only while playback uses them. */
+  UFUNCTION(BlueprintCallable, Category = "SimpleComp|Animation")
+  void ReleasePreloadedSequences();
+
+  /**
+   * Same as PlayEx, but returns a handle identifying this playback. The
+   * handle is unset if nothing could be played.
+   */
+  UFUNCTION(BlueprintCallable, Category = "SimpleComp|Animation")
+  FSCAnimHandle PlayWithHandle(USCAnimSequence *Sequence,
+                               float Duration = -1.0f, bool bFromStart = true,
+                               bool bReverse = false, bool bInLoop = false);
+
+  /** True while the handle's playback is running, paused or loading. */
+  UFUNCTION(BlueprintPure, Category = "SimpleComp|Animation")
+  bool IsHandleActive(const FSCAnimHandle &Handle) const;
+
+  /** Stops playback if the handle is still active. */
+  UFUNCTION(BlueprintCallable, Category = "SimpleComp|Animation")
+  void StopHandle(const FSCAnimHandle &Handle);
+
+  UFUNCTION(BlueprintCallable, Category = "SimpleComp|Animation")
+  void PauseHandle(const FSCAnimHandle &Handle);
+
+  UFUNCTION(BlueprintCallable, Category = "SimpleComp|Animation")
+  void ResumeHandle(const FSCAnimHandle &Handle);
+
+  /** Returns the native callbacks of an active handle, or null if it is
+   * stale. */
+  FSCAnimHandleDelegates *GetHandleDelegates(const FSCAnimHandle &Handle);
+
+  /**
+   * Plays the entries of a playlist back to back. Time left over when an
+   * entry ends is carried into the next one within the same update, so the
+   * chain has no gap. Stops any current playback; any other play call or
+   * Stop ends the playlist. OnAnimationFinished fires once, when the
+   * playlist ends.
+   */
+  UFUNCTION(BlueprintCallable, Category = "SimpleComp|Animation")
+  void PlayPlaylist(USCAnimPlaylist *Playlist);
+
+  UFUNCTION(BlueprintPure, Category = "SimpleComp|Animation")
+  USCAnimPlaylist *GetActivePlaylist() const { return ActivePlaylist; }
+
+  /** Index of the playing playlist entry, or INDEX_NONE. */
+  UFUNCTION(BlueprintPure, Category = "SimpleComp|Animation")
+  int32 GetPlaylistEntryIndex() const { return PlaylistEntry; }
+
   UFUNCTION(BlueprintCallable, Category = "SimpleComp|Animation")
   void PlayFromStart();
 
@@ -101,12 +234,113 @@ public:
   UFUNCTION(BlueprintPure, Category = "SimpleComp|Animation")
   bool IsPlaying() const { return bIsPlaying; }
 
+  /**
+   * Hands the transform over to an external driver such as Sequencer. The
+   * component's own playback is suspended, not stopped, until
+   * EndExternalControl is called.
+   */
+  void BeginExternalControl();
+  void EndExternalControl();
+  bool IsExternallyControlled() const { return bExternallyControlled; }
+
+  /**
+   * Blends a sample of Sequence at the given curve time into the transform.
+   * Samples applied during the same external evaluation are combined by
+   * weight; a total weight below 1 blends toward the base transform.
+   */
+  void ApplyExternalSample(USCAnimSequence *Sequence, float Time,
+                           float Weight);
+
+  /** Ends the current external evaluation, so the next sample applied to any
+   * component starts a new blend. */
+  static void AdvanceExternalEvaluation() { ++ExternalEvaluationSerial; }
+
 private:
+  friend class USCCurveAnimSubsystem;
+
   void UpdateAnimation(float DeltaTime);
-  void ApplyTransform();
-  void ApplyTransform(float SampleTime);
-  void ProcessNotifies(float OldTime, float NewTime);
-  float GetEffectiveDuration() const;
+  void CommitStep(const FSCAnimPlaybackStep &Step, float ReferenceScale,
+                  const FSCAnimChannelValues &Values);
+  void ApplyTransform(const FSCAnimChannelValues &Values);
+  void SetAnimatedTransform(const FTransform &Transform);
+  /** Takes over the direct children with a kinematic body, making their
+   * transforms absolute so moving this component does not teleport them. */
+  void ResolveKinematicChildren();
+  /** Hands driven children back to transform propagation. */
+  void ReleaseKinematicChildren();
+  /** Sends each driven child's base transform under this component's current
+   * transform to physics as its kinematic target. */
+  void ApplyKinematicChildren();
+  /** Evaluates the tracks bound to other components at CurrentTime and
+   * writes their relative transforms. Called while this component defers
+   * its child updates, so attached targets are moved once per update. */
+  void ApplyBoundTargets();
+  /** Evaluates the CustomFloat tracks at CurrentTime and writes them to the
+   * custom primitive data of their primitives. Adjacent slots of the same
+   * primitive are written together and unchanged values are skipped. */
+  void ApplyCustomData();
+  /** Finds the components named by the plan's bound targets. Components
+   * already driven keep the base transform captured when first found. */
+  void ResolveBoundTargets();
+  /** Broadcasts OnAnimationUpdate and its counterparts if any is bound. */
+  void BroadcastUpdate();
+  /** Registers with the batch subsystem or enables the component tick while
+   * playback is active, and turns both off once it is idle. */
+  void UpdateTickState();
+  void ProcessNotifies(const FSCAnimPlaybackStep &Step, float ReferenceScale);
+  bool FireNotify(int32 SortedIndex, uint32 Serial);
+  void ResetNotifyCursor(bool bClearFired);
+  void RefreshEvalPlan();
+
+  void StartPlayback(USCAnimSequence *Sequence, float Duration, bool bFromStart,
+                     bool bReverse, bool bInLoop);
+  /** Stores the handle in OutHandle before starting the load, so a callback
+   * that runs immediately sees it. */
+  void StartAsyncLoad(TSharedPtr<FStreamableHandle> &OutHandle,
+                      const TArray<FSoftObjectPath> &Paths,
+                      void (USCCurveAnimComponent::*Callback)());
+  void OnPendingPlayLoaded();
+  void CancelPendingPlay();
+  void OnPreloadLoaded();
+
+  /** True if the active playlist has an entry to play after the current
+   * one. */
+  bool HasNextPlaylistEntry() const;
+  /** Starts the next playlist entry and advances it by the time left over
+   * from the previous one. */
+  void ContinuePlaylist(float Excess);
+  /** Picks the next playlist entry and updates the pick and loop counts. */
+  int32 PickPlaylistEntry();
+  /** Swaps in the entry's plan and starts it from the beginning. */
+  void StartPlaylistEntry(int32 EntryIndex);
+  void ClearPlaylist();
+
+  int32 AcquireHandleSlot();
+  /** Makes the active handle stale and runs its OnFinished callback. */
+  void ReleaseActiveHandle(bool bInterrupted);
+  FSCAnimHandle MakeHandle(int32 SlotIndex) const;
+
+  /** A component driven by tracks bound to it, with the relative transform
+   * the tracks apply on top of. */
+  struct FBoundTarget {
+    TWeakObjectPtr<USceneComponent> Component;
+    FTransform Base;
+  };
+
+  struct FHandleSlot {
+    uint32 Generation = 0;
+    FSCAnimHandleDelegates Delegates;
+  };
+
+  /** Arguments of a PlayEx or PlaySoft call waiting for assets to load. */
+  struct FPendingPlay {
+    TSoftObjectPtr<USCAnimSequence> Sequence;
+    float Duration = -1.0f;
+    bool bFromStart = true;
+    bool bReverse = false;
+    bool bLoop = false;
+    bool bCurvesRequested = false;
+  };
 
   bool bIsPlaying = false;
   bool bIsPaused = false;
@@ -119,5 +353,86 @@ private:
 
   bool bReversePlayback = false;
 
-  TSet<int32> FiredNotifyIndices;
+  /** Boundary between the sorted notifies behind and ahead of the playback
+   * position, or INDEX_NONE when it must be located again. */
+  int32 NotifyCursor = INDEX_NONE;
+
+  /** Sorted notifies already fired during the current loop pass. Cleared
+   * whenever playback starts or changes direction. */
+  TBitArray<TInlineAllocator<4>> FiredNotifies;
+
+  /** Changes whenever playback is restarted, stopped or repositioned, so a
+   * notify listener doing so ends the current notify pass. */
+  uint32 PlaybackSerial = 0;
+
+  /** Resolved tracks of AnimSequence, rebuilt when the sequence changes. */
+  FSCAnimEvalPlan EvalPlan;
+
+  /** Components of EvalPlan's bound targets, in the same order. */
+  TArray<FBoundTarget> BoundTargets;
+  /** Relative transform of every component bound so far, captured the first
+   * time it was bound. A component unbound by a sequence change and bound
+   * again keeps it instead of capturing its animated transform. */
+  TMap<TWeakObjectPtr<USceneComponent>, FTransform> BoundTargetBases;
+  TArray<FSCAnimChannelValues> BoundValues;
+  TArray<float> CustomValues;
+
+  /** A child driven through kinematic targets, with its relative transform
+   * when it was taken over. */
+  struct FKinematicChild {
+    TWeakObjectPtr<UPrimitiveComponent> Primitive;
+    FTransform Base;
+  };
+
+  TArray<FKinematicChild> KinematicChildren;
+  bool bKinematicChildrenResolved = false;
+
+  FSCSignificanceState SignificanceState;
+
+  /** Slot in USCCurveAnimSubsystem while registered for batched playback. */
+  int32 BatchIndex = INDEX_NONE;
+
+  /** Slots of handles whose callbacks may still run. A slot is free while
+   * its generation is 0. */
+  TArray<FHandleSlot> HandleSlots;
+  int32 ActiveHandleSlot = INDEX_NONE;
+  uint32 NextHandleGeneration = 0;
+
+  FPendingPlay PendingPlay;
+  TSharedPtr<FStreamableHandle> PendingPlayHandle;
+
+  TArray<TSoftObjectPtr<USCAnimSequence>> PreloadedSequences;
+  TSharedPtr<FStreamableHandle> PreloadHandle;
+  TSharedPtr<FStreamableHandle> PreloadCurvesHandle;
+
+  UPROPERTY(Transient)
+  TObjectPtr<USCAnimPlaylist> ActivePlaylist;
+
+  int32 PlaylistEntry = INDEX_NONE;
+  /** Plays of the current entry left, including the current one. */
+  int32 PlaylistEntryLoopsLeft = 0;
+  /** Entry picks left, or -1 if the playlist repeats until stopped. */
+  int32 PlaylistPicksLeft = 0;
+  /** Number of entries chained within the current update. */
+  int32 PlaylistChainDepth = 0;
+  FRandomStream PlaylistRandom;
+  /** Plan of each playlist entry. Entries swap theirs with EvalPlan while
+   * they play, so chaining does not rebuild or allocate. */
+  TArray<FSCAnimEvalPlan> PlaylistPlans;
+
+  bool bExternallyControlled = false;
+
+  /** Value of ExternalEvaluationSerial when ExternalBlend was started. */
+  uint32 ExternalSampleSerial = 0;
+  float ExternalWeight = 0.0f;
+  /** Weighted sum of the external samples of the current evaluation. */
+  FTransform ExternalBlend;
+  /** Resolved tracks of the sequences sampled by the external driver. */
+  TArray<FSCAnimEvalPlan, TInlineAllocator<2>> ExternalPlans;
+  /** Sequences of ExternalPlans, held so the curves the plans point into
+   * cannot be collected while they are in use. */
+  UPROPERTY(Transient)
+  TArray<TObjectPtr<USCAnimSequence>> ExternalSequences;
+
+  static uint32 ExternalEvaluationSerial;
 };
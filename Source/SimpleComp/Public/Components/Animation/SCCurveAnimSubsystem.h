@@ -0,0 +1,57 @@
+#pragma once
+
+#include "Components/Animation/SCAnimEvalPlan.h"
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "SCCurveAnimSubsystem.generated.h"
+
+class USCCurveAnimComponent;
+
+/**
+ * Opt-in batched driver for curve animation components.
+ * Components with bUseBatchedEvaluation register here while playing instead of
+ * ticking individually. Playback state is kept as struct-of-arrays; time
+ * advance and curve evaluation run in a ParallelFor, then transforms and
+ * events are committed on the game thread in a single pass. Curves are
+ * evaluated through each component's own plan, refreshed on the game thread
+ * before the parallel pass.
+ */
+UCLASS()
+class SIMPLECOMP_API USCCurveAnimSubsystem : public UTickableWorldSubsystem {
+  GENERATED_BODY()
+
+public:
+  virtual void Tick(float DeltaTime) override;
+  virtual TStatId GetStatId() const override;
+  virtual void Deinitialize() override;
+
+  /** Adds a playing component, or refreshes its state if already
+   * registered. */
+  void Register(USCCurveAnimComponent *Component);
+
+  /** Removes a component. Safe to call while events are being dispatched;
+   * the slot is compacted at the start of the next tick. */
+  void Unregister(USCCurveAnimComponent *Component);
+
+private:
+  void RemovePending();
+
+  UPROPERTY(Transient)
+  TArray<TObjectPtr<USCCurveAnimComponent>> Components;
+
+  TArray<float> Times;
+  TArray<float> Rates;
+  TArray<float> Directions;
+  TArray<float> Durations;
+  TArray<uint8> Loops;
+
+  /** Set when a component's state was pushed after this frame's evaluation
+   * started, so its stale step is not committed. */
+  TArray<uint8> Resynced;
+
+  /** Evaluation plan of each component for the current tick, or null if
+   * the component is skipped. */
+  TArray<const FSCAnimEvalPlan *> Plans;
+  TArray<FSCAnimPlaybackStep> Steps;
+  TArray<FSCAnimChannelValues> Values;
+};
@@ -0,0 +1,175 @@
+#pragma once
+
+#include "Components/ActorComponent.h"
+#include "Components/Animation/SCAnimEvalPlan.h"
+#include "Core/SCSignificance.h"
+#include "CoreMinimal.h"
+#include "Engine/EngineTypes.h"
+#include "InstancedStaticMeshDelegates.h"
+#include "SCInstancedCurveAnimComponent.generated.h"
+
+class UInstancedStaticMeshComponent;
+class USCAnimSequence;
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FSCInstanceAnimFinishedSignature,
+                                            int32, InstanceIndex);
+
+/**
+ * Plays a USCAnimSequence on the instances of an instanced static mesh
+ * component. Every instance has its own time, play rate and loop state, and
+ * is animated on top of a base transform captured when the component first
+ * sees the instance, or by RefreshInstances. Instances removed from the mesh
+ * take their state with them. All instance transforms are written with a
+ * single batched update per frame. Notifies are not fired for instances.
+ */
+UCLASS(ClassGroup = (SimpleComp),
+       meta = (BlueprintSpawnableComponent,
+               DisplayName = "Simple Instanced Curve Animation Component"))
+class SIMPLECOMP_API USCInstancedCurveAnimComponent : public UActorComponent {
+  GENERATED_BODY()
+
+public:
+  USCInstancedCurveAnimComponent();
+
+  virtual void
+  TickComponent(float DeltaTime, ELevelTick TickType,
+                FActorComponentTickFunction *ThisTickFunction) override;
+
+  virtual void BeginPlay() override;
+
+  virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+  /** Instanced or hierarchical instanced mesh to animate. If unset, the first
+   * one found on the owner is used. */
+  UPROPERTY(EditAnywhere, Category = "SimpleComp|Animation",
+            meta = (UseComponentPicker,
+                    AllowedClasses =
+                        "/Script/Engine.InstancedStaticMeshComponent"))
+  FComponentReference InstancedMesh;
+
+  UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SimpleComp|Animation")
+  TObjectPtr<USCAnimSequence> AnimSequence;
+
+  UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SimpleComp|Animation",
+            meta = (ClampMin = "0.01"))
+  float PlaybackDuration = 1.0f;
+
+  /** Play rate given to instances started by Play. */
+  UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SimpleComp|Animation")
+  float PlayRate = 1.0f;
+
+  /** Loop state given to instances started by Play. */
+  UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SimpleComp|Animation")
+  bool bLoop = true;
+
+  UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SimpleComp|Animation")
+  bool bAutoPlay = true;
+
+  /** Instances started by Play begin at a random time in [0, this range), so
+   * large groups do not move in lockstep. */
+  UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SimpleComp|Animation",
+            meta = (ClampMin = "0.0", Units = "s"))
+  float RandomTimeOffset = 0.0f;
+
+  /** Distance and visibility based tick throttling. */
+  UPROPERTY(EditAnywhere, BlueprintReadWrite,
+            Category = "SimpleComp|Performance")
+  FSCSignificanceSettings Significance;
+
+  /** Broadcast when a non-looping instance reaches its end. */
+  UPROPERTY(BlueprintAssignable, Category = "SimpleComp|Animation")
+  FSCInstanceAnimFinishedSignature OnInstanceFinished;
+
+  /** Starts every instance using PlayRate, bLoop and RandomTimeOffset. */
+  UFUNCTION(BlueprintCallable, Category = "SimpleComp|Animation")
+  void Play();
+
+  /**
+   * Starts a single instance.
+   * @param InstanceIndex Index of the instance in the mesh component.
+   * @param StartTime Playback time to start from, in seconds.
+   * @param InPlayRate Play rate of the instance.
+   * @param bInLoop Whether the instance loops.
+   */
+  UFUNCTION(BlueprintCallable, Category = "SimpleComp|Animation")
+  void PlayInstance(int32 InstanceIndex, float StartTime = 0.0f,
+                    float InPlayRate = 1.0f, bool bInLoop = true);
+
+  /** Stops every instance, leaving it at its current transform. */
+  UFUNCTION(BlueprintCallable, Category = "SimpleComp|Animation")
+  void Stop();
+
+  UFUNCTION(BlueprintCallable, Category = "SimpleComp|Animation")
+  void StopInstance(int32 InstanceIndex);
+
+  UFUNCTION(BlueprintCallable, Category = "SimpleComp|Animation")
+  void SetInstancePlayRate(int32 InstanceIndex, float InPlayRate);
+
+  /** Re-captures the base transform of every instance from the mesh. Call
+   * while stopped, after moving instances from elsewhere. */
+  UFUNCTION(BlueprintCallable, Category = "SimpleComp|Animation")
+  void RefreshInstances();
+
+  UFUNCTION(BlueprintPure, Category = "SimpleComp|Animation")
+  bool IsInstancePlaying(int32 InstanceIndex) const;
+
+  UFUNCTION(BlueprintPure, Category = "SimpleComp|Animation")
+  int32 GetNumPlayingInstances() const { return NumPlaying; }
+
+private:
+  UInstancedStaticMeshComponent *ResolveInstancedMesh();
+
+  /** Matches the per-instance state to the mesh's instance count, capturing
+   * base transforms of added instances. */
+  void SyncInstanceCount(const UInstancedStaticMeshComponent &Mesh);
+  /** Reads the base transform of an instance from the mesh. */
+  void CaptureBase(const UInstancedStaticMeshComponent &Mesh,
+                   int32 InstanceIndex);
+
+  /** Follows removals and relocations of the mesh's instances, so the
+   * per-instance state stays at the index of its instance. */
+  void OnInstanceIndexUpdated(
+      UInstancedStaticMeshComponent *Component,
+      TArrayView<const FInstancedStaticMeshDelegates::FInstanceIndexUpdateData>
+          IndexUpdates);
+  /** Moves the state of an instance to another index and stops From. */
+  void MoveInstance(int32 From, int32 To);
+
+  void StartInstance(int32 InstanceIndex, float StartTime, float InPlayRate,
+                     bool bInLoop);
+  /** Writes the CustomFloat values of the instances updated this frame to
+   * their per-instance custom data, without marking the render state dirty;
+   * the transform update that follows does. The mesh's custom data only
+   * grows when a track writes past it, and keeps its existing values. */
+  void WriteCustomData(UInstancedStaticMeshComponent &Mesh, int32 NumCustom);
+  /** Writes the transforms of the instances updated this frame and marks the
+   * render state dirty. Stopped instances are left untouched. */
+  void WriteTransforms(UInstancedStaticMeshComponent &Mesh);
+  void UpdateTickState();
+
+  UPROPERTY(Transient)
+  TObjectPtr<UInstancedStaticMeshComponent> CachedMesh;
+
+  TArray<FVector> BaseLocations;
+  TArray<FRotator> BaseRotations;
+  TArray<FVector> BaseScales;
+  TArray<float> Times;
+  TArray<float> Rates;
+  TArray<uint8> Loops;
+  TArray<uint8> Playing;
+  TArray<uint8> FinishedThisFrame;
+
+  /** Last written transform of every instance, in mesh space. Only entries
+   * of instances updated this frame are current. */
+  TArray<FTransform> Transforms;
+
+  /** CustomFloat values of every instance updated this frame, one run of
+   * EvalPlan.GetNumSelfCustomOps() values per instance. */
+  TArray<float> CustomValues;
+
+  int32 NumPlaying = 0;
+
+  FSCAnimEvalPlan EvalPlan;
+  FSCSignificanceState SignificanceState;
+  FDelegateHandle InstanceIndexUpdatedHandle;
+};
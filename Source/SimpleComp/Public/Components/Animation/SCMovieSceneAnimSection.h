@@ -0,0 +1,50 @@
+#pragma once
+
+#include "Channels/MovieSceneFloatChannel.h"
+#include "CoreMinimal.h"
+#include "MovieSceneSection.h"
+#include "SCMovieSceneAnimSection.generated.h"
+
+class USCAnimSequence;
+
+/**
+ * Sequencer section that plays a USCAnimSequence on a bound
+ * USCCurveAnimComponent. The sequence time is derived from the section time
+ * alone, so scrubbing and seeking are deterministic.
+ */
+UCLASS(meta = (DisplayName = "Simple Animation Section"))
+class SIMPLECOMP_API USCMovieSceneAnimSection : public UMovieSceneSection {
+  GENERATED_BODY()
+
+public:
+  USCMovieSceneAnimSection(const FObjectInitializer &ObjectInitializer);
+
+  UPROPERTY(EditAnywhere, Category = "SimpleComp|Animation")
+  TObjectPtr<USCAnimSequence> Sequence;
+
+  UPROPERTY(EditAnywhere, Category = "SimpleComp|Animation",
+            meta = (ClampMin = "0.01"))
+  float PlayRate = 1.0f;
+
+  /** Sequence time, in seconds, at the start of the section. */
+  UPROPERTY(EditAnywhere, Category = "SimpleComp|Animation",
+            meta = (Units = "s"))
+  float StartOffset = 0.0f;
+
+  /** If false, the sequence holds its last pose once it reaches its end. */
+  UPROPERTY(EditAnywhere, Category = "SimpleComp|Animation")
+  bool bLoop = false;
+
+  /** Blend weight of the section against overlapping sections and the
+   * component's base transform. Multiplied by the section's easing. */
+  UPROPERTY()
+  FMovieSceneFloatChannel Weight;
+
+  /** Returns the sequence's curve time at the given sequence time. */
+  float GetSequenceTime(FFrameTime Time, FFrameRate TickResolution) const;
+
+  /** Returns the blend weight at the given time, including easing. */
+  float GetWeight(FFrameTime Time) const;
+
+  virtual TOptional<TRange<FFrameNumber>> GetAutoSizeRange() const override;
+};
@@ -0,0 +1,45 @@
+#pragma once
+
+#include "Compilation/IMovieSceneTrackTemplateProducer.h"
+#include "CoreMinimal.h"
+#include "MovieSceneNameableTrack.h"
+#include "SCMovieSceneAnimTrack.generated.h"
+
+/**
+ * Sequencer track that drives a USCCurveAnimComponent from
+ * USCMovieSceneAnimSection sections. While the track animates a component,
+ * the component's own playback and tick are suspended; overlapping sections
+ * are blended by weight. Sections are evaluated through evaluation templates,
+ * whose samples are applied on the game thread.
+ */
+UCLASS(meta = (DisplayName = "Simple Animation Track"))
+class SIMPLECOMP_API USCMovieSceneAnimTrack
+    : public UMovieSceneNameableTrack,
+      public IMovieSceneTrackTemplateProducer {
+  GENERATED_BODY()
+
+public:
+  USCMovieSceneAnimTrack(const FObjectInitializer &ObjectInitializer);
+
+  virtual bool
+  SupportsType(TSubclassOf<UMovieSceneSection> SectionClass) const override;
+  virtual UMovieSceneSection *CreateNewSection() override;
+  virtual const TArray<UMovieSceneSection *> &GetAllSections() const override;
+  virtual bool HasSection(const UMovieSceneSection &Section) const override;
+  virtual void AddSection(UMovieSceneSection &Section) override;
+  virtual void RemoveSection(UMovieSceneSection &Section) override;
+  virtual void RemoveSectionAt(int32 SectionIndex) override;
+  virtual void RemoveAllAnimationData() override;
+  virtual bool IsEmpty() const override;
+  virtual bool SupportsMultipleRows() const override { return true; }
+#if WITH_EDITORONLY_DATA
+  virtual FText GetDefaultDisplayName() const override;
+#endif
+
+  virtual FMovieSceneEvalTemplatePtr
+  CreateTemplateForSection(const UMovieSceneSection &InSection) const override;
+
+private:
+  UPROPERTY()
+  TArray<TObjectPtr<UMovieSceneSection>> AnimationSections;
+};
@@ -1,6 +1,8 @@
 #pragma once
 
 #include "Components/ActorComponent.h"
+#include "Core/SCSignificance.h"
+#include "Core/SCAxisConstraint.h"
 #include "Core/SCTypes.h"
 #include "CoreMinimal.h"
 #include "SCFollowConstraintComponent.generated.h"
@@ -23,8 +25,11 @@ public:
 
   // --- Core Settings ---
 
-  /** The actor to follow and maintain distance from. */
-  UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SimpleComp|CORE")
+  /** The actor to follow and maintain distance from. While neither a target
+   * nor chain followers are set the component only polls for one at a low
+   * rate; SetFollowTarget resumes it immediately. */
+  UPROPERTY(EditAnywhere, BlueprintSetter = SetFollowTarget,
+            Category = "SimpleComp|CORE")
   TObjectPtr<AActor> FollowTarget;
 
   /** Maximum allowed distance from the FollowTarget before the owner starts
@@ -73,18 +78,101 @@ public:
             Category = "SimpleComp|Axis Control (Rotation)")
   FSCAxisSettings RollSettings;
 
+  // --- Chain ---
+
+  /** Actors that follow the owner as a chain, each kept within RopeLength of
+   * the one before it. The chain is solved front to back in this component's
+   * tick and written in one pass, so every link moves in the same frame as
+   * the owner, with or without a FollowTarget. Followers should not run their
+   * own follow constraint. */
+  UPROPERTY(EditAnywhere, BlueprintSetter = SetChainFollowers,
+            Category = "SimpleComp|Chain")
+  TArray<TObjectPtr<AActor>> ChainFollowers;
+
+  /** If true, followers are simulated with Verlet integration under
+   * ChainGravity, so slack links sag and swing instead of stopping. */
+  UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SimpleComp|Chain")
+  bool bChainVerlet = false;
+
+  UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SimpleComp|Chain",
+            meta = (EditCondition = "bChainVerlet"))
+  FVector ChainGravity = FVector(0.0, 0.0, -980.0);
+
+  /** Fraction of each follower's velocity lost per 1/60 s. */
+  UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SimpleComp|Chain",
+            meta = (EditCondition = "bChainVerlet", ClampMin = "0.0",
+                    ClampMax = "1.0"))
+  float ChainDamping = 0.05f;
+
+  /** Fraction of a stretched link corrected per iteration. Lower values
+   * make the chain elastic. */
+  UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SimpleComp|Chain",
+            meta = (EditCondition = "bChainVerlet", ClampMin = "0.0",
+                    ClampMax = "1.0"))
+  float ChainStiffness = 1.0f;
+
+  /** Constraint passes over the chain per update. */
+  UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SimpleComp|Chain",
+            meta = (EditCondition = "bChainVerlet", ClampMin = "1",
+                    ClampMax = "16"))
+  int32 ChainIterations = 2;
+
+  // --- Performance ---
+
+  /** Distance and visibility based tick throttling. */
+  UPROPERTY(EditAnywhere, BlueprintReadWrite,
+            Category = "SimpleComp|Performance")
+  FSCSignificanceSettings Significance;
+
+  /** Sets the actor to follow and resumes ticking if it was idle. */
+  UFUNCTION(BlueprintSetter)
+  void SetFollowTarget(AActor *NewTarget);
+
+  /** Sets the chain followers and resumes ticking if it was idle. */
+  UFUNCTION(BlueprintSetter)
+  void SetChainFollowers(const TArray<AActor *> &NewFollowers);
+
 protected:
   virtual void BeginPlay() override;
   virtual void
   TickComponent(float DeltaTime, ELevelTick TickType,
                 FActorComponentTickFunction *ThisTickFunction) override;
+#if WITH_EDITOR
+  virtual void
+  PostEditChangeProperty(FPropertyChangedEvent &PropertyChangedEvent) override;
+#endif
 
 private:
-  /** Helper to process a single axis based on settings. */
-  float ProcessAxis(float CurrentVal, float TargetVal,
-                    const FSCAxisSettings &Settings);
+  /** True while there is a target to follow or a chain to solve. */
+  bool WantsTick() const;
+
+  /** Resumes per-frame ticking if the component became active while
+   * idle. */
+  void UpdateTickState();
+
+  /** Keeps the owner within RopeLength of FollowTarget. */
+  void FollowTargetActor(AActor &Owner, float DeltaTime);
+
+  /** Moves ChainFollowers behind the owner. */
+  void SolveChain(const AActor &Owner, float DeltaTime);
 
   /** Tracks the location from the previous frame to calculate movement delta
    * for rotation. */
   FVector LastLocation;
+
+  FSCSignificanceState SignificanceState;
+
+  /** True while the tick only polls for a target or chain. */
+  bool bIdle = false;
+
+  /** Pitch, Yaw and Roll settings applied in quaternion space. */
+  FSCAxisConstraint AxisConstraint;
+
+  /** Chain state, indexed like ChainFollowers. */
+  TArray<FVector> ChainPositions;
+  TArray<FVector> ChainPrevPositions;
+  /** Time step that led to ChainPositions from ChainPrevPositions, or 0 if
+   * the history was just reset. */
+  float ChainPrevDeltaTime = 0.0f;
+  TArray<FQuat> ChainRotations;
 };
@@ -1,6 +1,8 @@
 #pragma once
 
 #include "Components/SceneComponent.h"
+#include "Core/SCSignificance.h"
+#include "Core/SCAxisConstraint.h"
 #include "Core/SCTypes.h"
 #include "CoreMinimal.h"
 #include "SCRotationComponent.generated.h"
@@ -18,11 +20,24 @@ class SIMPLECOMP_API USCRotationComponent : public USceneComponent {
 public:
   USCRotationComponent();
 
+  /** Rewrites the spin custom primitive data of the attached primitives.
+   * Call it after changing RotationRate, RotationPhase or SpinCustomDataIndex
+   * at runtime. Does nothing unless the component spins through
+   * CustomPrimitiveData. */
+  UFUNCTION(BlueprintCallable, Category = "SimpleComp|Constant")
+  void RefreshSpinCustomData();
+
 protected:
   virtual void BeginPlay() override;
+  virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
   virtual void
   TickComponent(float DeltaTime, ELevelTick TickType,
                 FActorComponentTickFunction *ThisTickFunction) override;
+  virtual void OnChildAttached(USceneComponent *ChildComponent) override;
+#if WITH_EDITOR
+  virtual void
+  PostEditChangeProperty(FPropertyChangedEvent &PropertyChangedEvent) override;
+#endif
 
   // --- General Settings ---
 
@@ -83,6 +98,50 @@ protected:
             Interp)
   FVector TargetLocationOffset;
 
+  /** If true, TargetActor is picked periodically by the world's
+   * USCTargetingSubsystem among actors of AutoTargetClass carrying
+   * AutoTargetTag. */
+  UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "SimpleComp|Target",
+            meta = (EditCondition = "RotationMode == ESCRotationMode::ToTarget",
+                    EditConditionHides))
+  bool bAutoAcquireTarget = false;
+
+  /** Class of candidate actors. Any actor if unset. */
+  UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "SimpleComp|Target",
+            meta = (EditCondition = "bAutoAcquireTarget"))
+  TSubclassOf<AActor> AutoTargetClass;
+
+  /** Tag candidate actors must carry. Ignored if None. Tags are read when
+   * an actor spawns or streams in, and again when it is passed to
+   * USCTargetingSubsystem::RefreshCandidate. */
+  UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "SimpleComp|Target",
+            meta = (EditCondition = "bAutoAcquireTarget"))
+  FName AutoTargetTag;
+
+  UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SimpleComp|Target",
+            meta = (EditCondition = "bAutoAcquireTarget"))
+  ESCAutoTargetSelection AutoTargetSelection = ESCAutoTargetSelection::Nearest;
+
+  /** Acquisition radius around the component. */
+  UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SimpleComp|Target",
+            meta = (EditCondition = "bAutoAcquireTarget", ClampMin = "0.0",
+                    Units = "cm"))
+  float AutoTargetRadius = 3000.0f;
+
+  /** Half angle of the acquisition cone around the attach parent's forward
+   * vector, or the component's own if it has no parent. */
+  UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SimpleComp|Target",
+            meta = (EditCondition = "bAutoAcquireTarget", ClampMin = "0.0",
+                    ClampMax = "180.0", Units = "deg"))
+  float AutoTargetConeAngle = 180.0f;
+
+  /** Time between re-acquisitions. Queries are also spread across frames
+   * under a shared per-frame budget. */
+  UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SimpleComp|Target",
+            meta = (EditCondition = "bAutoAcquireTarget", ClampMin = "0.0",
+                    Units = "s"))
+  float AutoTargetInterval = 0.5f;
+
   /** Degrees per second to rotate in Constant mode (Applied in Local Space). */
   UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SimpleComp|Constant",
             meta = (EditCondition = "RotationMode == ESCRotationMode::Constant",
@@ -90,6 +149,41 @@ protected:
             Interp)
   FRotator RotationRate = FRotator(0.f, 90.f, 0.f);
 
+  /** How Constant rotation is evaluated. Analytic rotation is a function of
+   * world time alone, so it stays exact with tick throttling and identical
+   * spinners stay in sync. */
+  UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SimpleComp|Constant",
+            meta = (EditCondition = "RotationMode == ESCRotationMode::Constant",
+                    EditConditionHides))
+  ESCConstantRotationMethod ConstantMethod =
+      ESCConstantRotationMethod::Accumulate;
+
+  /** Seconds added to world time before evaluating analytic rotation. Use it
+   * to desynchronize identical spinners. */
+  UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SimpleComp|Constant",
+            meta = (EditCondition = "RotationMode == ESCRotationMode::Constant "
+                                    "&& ConstantMethod != "
+                                    "ESCConstantRotationMethod::Accumulate",
+                    EditConditionHides, ForceUnits = "s"))
+  float RotationPhase = 0.0f;
+
+  /**
+   * First of five custom primitive data slots written on the primitives
+   * attached directly to this component: the local rotation axis (3), the
+   * angular speed in radians per second and the phase angle in radians. The
+   * material rotates by Speed * Time + Phase around the axis. Written at
+   * BeginPlay and when a primitive is attached; later changes take effect
+   * through RefreshSpinCustomData.
+   */
+  UPROPERTY(
+      EditAnywhere, BlueprintReadWrite, Category = "SimpleComp|Constant",
+      meta = (EditCondition =
+                  "RotationMode == ESCRotationMode::Constant && "
+                  "ConstantMethod == "
+                  "ESCConstantRotationMethod::CustomPrimitiveData",
+              EditConditionHides, ClampMin = "0"))
+  int32 SpinCustomDataIndex = 0;
+
   /** Minimum movement distance (cm) to trigger rotation update in Forward Delta
    * mode. */
   UPROPERTY(
@@ -107,21 +201,74 @@ protected:
       Interp)
   float VelocityThreshold = 10.0f;
 
+  // --- Performance ---
+
+  /** If true, the component is updated by the world's USCRotationSubsystem,
+   * which solves all opted-in components in parallel batches and reads each
+   * target actor's location once per frame. The component's own tick stays
+   * disabled while registered. */
+  UPROPERTY(EditAnywhere, BlueprintReadOnly,
+            Category = "SimpleComp|Performance")
+  bool bUseBatchedEvaluation = false;
+
+  /** Distance and visibility based tick throttling. Under batched
+   * evaluation the subsystem skips the component until its interval has
+   * elapsed. */
+  UPROPERTY(EditAnywhere, BlueprintReadWrite,
+            Category = "SimpleComp|Performance")
+  FSCSignificanceSettings Significance;
+
 private:
-  /** Clamps or locks an axis based on user settings. */
-  float ProcessAxis(float TargetAngle, const FSCAxisSettings &Settings);
+  friend class USCRotationSubsystem;
+  friend class USCTargetingSubsystem;
+
+  /** Returns the relative rotation after a Constant update. */
+  FQuat ComputeConstantRotation(const FQuat &CurrentQuat,
+                                float DeltaTime) const;
+
+  /** Returns the local spin axis and angular speed in radians per second
+   * equivalent to RotationRate. */
+  void GetSpinAxisAndSpeed(FVector &OutAxis, double &OutSpeed) const;
+
+  /** True if Constant rotation is driven through custom primitive data. */
+  bool UsesSpinCustomData() const;
+
+  /** Writes the spin to the custom primitive data of attached primitives. */
+  void WriteSpinCustomData();
+
+  /** Handles the bLookAtTarget toggle and returns the world orientation to
+   * track this update. */
+  FQuat ComputeTargetWorldQuat();
+
+  /**
+   * Returns the next relative rotation from the world orientation to track.
+   * Reads settings only and reports the switching state through bSwitching,
+   * so batched updates can run it off the game thread.
+   */
+  FQuat SolveRotation(const FQuat &TargetWorldQuat, const FQuat &ParentQuat,
+                      const FQuat &CurrentQuat, float DeltaTime,
+                      bool &bSwitching) const;
 
   /** Returns world orientation toward a target or offset. */
   FQuat ComputeTargetQuat();
 
+  /** Returns the target actor's location, read through the subsystem's
+   * per-frame cache while batched. */
+  FVector GetTargetActorLocation() const;
+
   /** Returns world orientation toward the owner's velocity. */
   FQuat ComputeVelocityQuat();
 
   /** Returns world orientation toward current movement direction. */
   FQuat ComputeForwardDeltaQuat();
 
-  /** Manages the bIsSwitchingTarget state based on angular distance. */
-  void UpdateTargetSwitching(const FQuat &CurrentQuat, const FQuat &TargetQuat);
+  /** Clears bSwitching once the angular distance is within
+   * SwitchThreshold. */
+  void UpdateTargetSwitching(const FQuat &CurrentQuat, const FQuat &TargetQuat,
+                             bool &bSwitching) const;
+
+  /** Relative rotation at BeginPlay, the base of analytic rotation. */
+  FQuat InitialQuat = FQuat::Identity;
 
   /** Location stored from previous frame for delta calculation. */
   FVector LastLocation;
@@ -134,4 +281,16 @@ private:
 
   /** Tracking variable for the bLookAtTarget toggle. */
   bool bLastLookAtTarget = true;
+
+  FSCSignificanceState SignificanceState;
+
+  /** Pitch, Yaw and Roll settings applied in quaternion space. Updated on
+   * the game thread before each solve. */
+  FSCAxisConstraint AxisConstraint;
+
+  /** Slot in USCRotationSubsystem while registered for batched updates. */
+  int32 BatchIndex = INDEX_NONE;
+
+  /** Slot in USCTargetingSubsystem while acquiring targets. */
+  int32 SeekerIndex = INDEX_NONE;
 };
\ No newline at end of file
@@ -0,0 +1,58 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "SCRotationSubsystem.generated.h"
+
+class AActor;
+class USCRotationComponent;
+
+/**
+ * Opt-in batched driver for rotation components.
+ * Components with bUseBatchedEvaluation register here instead of ticking
+ * individually. Target orientations and parent and current rotations are
+ * gathered into struct-of-arrays buffers on the game thread, reading each
+ * target actor's location once per frame. Constraints and interpolation are
+ * solved in a ParallelFor, then rotations are written back in a single pass.
+ */
+UCLASS()
+class SIMPLECOMP_API USCRotationSubsystem : public UTickableWorldSubsystem {
+  GENERATED_BODY()
+
+public:
+  virtual void Tick(float DeltaTime) override;
+  virtual TStatId GetStatId() const override;
+  virtual void Deinitialize() override;
+
+  /** Adds a component. Does nothing if it is already registered. */
+  void Register(USCRotationComponent *Component);
+
+  /** Removes a component. The slot is compacted at the start of the next
+   * tick. */
+  void Unregister(USCRotationComponent *Component);
+
+  /** Returns the actor's location, read once per frame and shared by all
+   * registered components tracking it. */
+  FVector GetTargetLocation(const AActor &Actor);
+
+private:
+  void RemovePending();
+
+  UPROPERTY(Transient)
+  TArray<TObjectPtr<USCRotationComponent>> Components;
+
+  /** World orientation to track. Unused for components in Constant mode,
+   * whose result is computed while gathering. */
+  TArray<FQuat> TargetQuats;
+  TArray<FQuat> ParentQuats;
+  TArray<FQuat> CurrentQuats;
+  TArray<FQuat> Results;
+  /** Time to simulate this frame after significance throttling. Zero skips
+   * the entry. */
+  TArray<float> StepTimes;
+  TArray<uint8> Constant;
+  TArray<uint8> Switching;
+
+  /** Per-frame cache of target actor locations. */
+  TMap<const AActor *, FVector> TargetLocations;
+};
@@ -2,6 +2,7 @@
 
 #include "CoreMinimal.h"
 #include "Components/SceneComponent.h"
+#include "Core/SCSignificance.h"
 #include "SCSphereRollComponent.generated.h"
 
 /**
@@ -19,6 +20,7 @@ public:
 
 protected:
 	virtual void BeginPlay() override;
+	virtual void OnUpdateTransform(EUpdateTransformFlags UpdateTransformFlags, ETeleportType Teleport = ETeleportType::None) override;
 
 public:
 	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
@@ -31,7 +33,12 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SimpleComp|Sphere Settings")
 	bool bInvertRotation = false;
 
+	/** Distance and visibility based tick throttling. Rotation is driven by distance travelled, so throttled spheres catch up fully on their next update. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SimpleComp|Performance")
+	FSCSignificanceSettings Significance;
+
 private:
 	FVector LastLocation;
 	FQuat CurrentRotationQuat;
+	FSCSignificanceState SignificanceState;
 };
\ No newline at end of file
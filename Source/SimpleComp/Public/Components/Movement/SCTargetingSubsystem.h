@@ -0,0 +1,86 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "SCTargetingSubsystem.generated.h"
+
+class AActor;
+class ULevel;
+class USCRotationComponent;
+
+/**
+ * Shared target acquisition for rotation components with bAutoAcquireTarget.
+ * Candidate actors are grouped into pools by class and tag. Each pool is
+ * filled once from the loaded actors, then kept up to date from spawn and
+ * level streaming events and RefreshCandidate. Each frame refreshes the
+ * locations of a bounded slice of every pool, dropping destroyed actors and
+ * rehashing only candidates that changed cell in a 2D spatial hash. Seekers
+ * query their pool for the best candidate within a radius and cone; queries
+ * are spread across frames under a fixed budget.
+ */
+UCLASS()
+class SIMPLECOMP_API USCTargetingSubsystem : public UTickableWorldSubsystem {
+  GENERATED_BODY()
+
+public:
+  virtual void Tick(float DeltaTime) override;
+  virtual TStatId GetStatId() const override;
+  virtual void Deinitialize() override;
+
+  /** Adds a component that acquires its target through this subsystem.
+   * Its first query runs on the next tick. */
+  void AddSeeker(USCRotationComponent *Component);
+
+  /** Removes a seeker. The slot is compacted at the start of the next
+   * tick. */
+  void RemoveSeeker(USCRotationComponent *Component);
+
+  /** Matches an actor against every pool again on the next tick. Tags are
+   * only re-read here, so call it after adding or removing a tag seekers
+   * look for on an existing actor. */
+  UFUNCTION(BlueprintCallable, Category = "SimpleComp|Targeting")
+  void RefreshCandidate(AActor *Actor);
+
+private:
+  struct FCandidatePool {
+    TSubclassOf<AActor> Class;
+    FName Tag;
+    TArray<TWeakObjectPtr<AActor>> Actors;
+    /** Index of each candidate in Actors. */
+    TMap<TWeakObjectPtr<AActor>, int32> Members;
+    TArray<FVector> Locations;
+    TArray<FIntPoint> CellKeys;
+    TMap<FIntPoint, TArray<int32>> Cells;
+    /** Candidate at which the next location refresh resumes. */
+    int32 RefreshCursor = 0;
+  };
+
+  int32 FindOrAddPool(TSubclassOf<AActor> Class, FName Tag);
+  void AddCandidate(FCandidatePool &Pool, AActor *Actor);
+  void RemoveCandidate(FCandidatePool &Pool, int32 Index);
+  void UpdatePool(FCandidatePool &Pool);
+  AActor *FindBestCandidate(const FCandidatePool &Pool,
+                            const USCRotationComponent &Seeker) const;
+  void AddPendingActors();
+  void OnActorSpawned(AActor *Actor);
+  void OnLevelAdded(ULevel *Level, UWorld *World);
+  void RemovePending();
+
+  UPROPERTY(Transient)
+  TArray<TObjectPtr<USCRotationComponent>> Seekers;
+
+  TArray<int32> SeekerPools;
+  TArray<double> NextQueryTimes;
+
+  /** Seeker at which the next tick resumes its queries. */
+  int32 QueryCursor = 0;
+
+  TArray<FCandidatePool> Pools;
+
+  /** Actors spawned, streamed in or refreshed since the last tick. They are
+   * matched on the next tick, once BeginPlay has set up their tags. */
+  TArray<TWeakObjectPtr<AActor>> PendingActors;
+
+  FDelegateHandle ActorSpawnedHandle;
+  FDelegateHandle LevelAddedHandle;
+};
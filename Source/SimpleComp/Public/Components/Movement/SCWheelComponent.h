@@ -2,6 +2,7 @@
 
 #include "CoreMinimal.h"
 #include "Components/SceneComponent.h"
+#include "Core/SCSignificance.h"
 #include "SCWheelComponent.generated.h"
 
 /**
@@ -18,6 +19,7 @@ public:
 
 protected:
 	virtual void BeginPlay() override;
+	virtual void OnUpdateTransform(EUpdateTransformFlags UpdateTransformFlags, ETeleportType Teleport = ETeleportType::None) override;
 
 public:
 	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
@@ -46,8 +48,13 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SimpleComp|Wheel Settings")
 	bool bInvertRoll = false;
 
+	/** Distance and visibility based tick throttling. Roll is driven by distance travelled, so throttled wheels never under-rotate. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SimpleComp|Performance")
+	FSCSignificanceSettings Significance;
+
 private:
 	FVector LastLocation;
 	float CurrentRollRotation = 0.0f;
 	float CurrentSteerYaw = 0.0f;
+	FSCSignificanceState SignificanceState;
 };
\ No newline at end of file
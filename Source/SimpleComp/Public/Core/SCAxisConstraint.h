@@ -0,0 +1,44 @@
+#pragma once
+
+#include "Core/SCTypes.h"
+#include "CoreMinimal.h"
+
+/**
+ * Applies per-axis FSCAxisSettings to a rotation in quaternion space.
+ * The rotation is split into a twist about Z (Yaw) and a swing of the Z axis
+ * (Pitch about the yawed Y, Roll about the yawed X). Rotations without roll
+ * keep their exact yaw and pitch, and the split has no singularity at
+ * +/-90 degrees pitch. Each part is expressed as the tangent of a quarter of
+ * its angle, where the limits are plain clamps, so no Euler conversion or
+ * trigonometry runs per update and Free axes pass through exactly. Limit
+ * angles are converted once when the settings change.
+ */
+struct SIMPLECOMP_API FSCAxisConstraint {
+  /** Rebuilds the limits if the settings changed since the last call. */
+  void Update(const FSCAxisSettings &Pitch, const FSCAxisSettings &Yaw,
+              const FSCAxisSettings &Roll);
+
+  /** True if all axes are Free, in which case Apply returns its input. */
+  bool IsFree() const { return bAllFree; }
+
+  /**
+   * Returns the rotation with its axes limited. Locked axes take their value
+   * from Reference.
+   */
+  FQuat Apply(const FQuat &Rotation,
+              const FQuat &Reference = FQuat::Identity) const;
+
+private:
+  /** Coordinate order: yaw, pitch, roll. */
+  static constexpr int32 NumAxes = 3;
+
+  ESCAxisMode Modes[NumAxes] = {ESCAxisMode::Free, ESCAxisMode::Free,
+                                ESCAxisMode::Free};
+  double Lower[NumAxes] = {-1.0, -1.0, -1.0};
+  double Upper[NumAxes] = {1.0, 1.0, 1.0};
+  bool bAllFree = true;
+  bool bHasLockedAxis = false;
+
+  FSCAxisSettings Settings[NumAxes];
+  bool bInitialized = false;
+};
@@ -0,0 +1,87 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Curves/CurveFloat.h"
+#include "SCSignificance.generated.h"
+
+class AActor;
+class UActorComponent;
+class UWorld;
+
+/**
+ * Shared tick-rate LOD policy for SimpleComp components.
+ * The tick interval is picked from the distance to the nearest local camera,
+ * then raised to NotRenderedTickInterval when the owner has not been rendered
+ * recently.
+ */
+USTRUCT(BlueprintType)
+struct SIMPLECOMP_API FSCSignificanceSettings {
+  GENERATED_BODY()
+
+  /** Enables tick throttling. When false, the component ticks every frame. */
+  UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Significance")
+  bool bEnabled = false;
+
+  /** Tick interval in seconds (Y) by distance to the nearest camera in cm
+   * (X). Constant keys form discrete distance bands. */
+  UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Significance",
+            meta = (EditCondition = "bEnabled", XAxisName = "Distance (cm)",
+                    YAxisName = "Tick Interval (s)"))
+  FRuntimeFloatCurve TickIntervalByDistance;
+
+  /** Minimum tick interval while the owner is not being rendered. */
+  UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Significance",
+            meta = (EditCondition = "bEnabled", ClampMin = "0.0",
+                    Units = "s"))
+  float NotRenderedTickInterval = 0.25f;
+
+  /** How long after its last render the owner still counts as rendered. */
+  UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Significance",
+            meta = (EditCondition = "bEnabled", ClampMin = "0.0",
+                    Units = "s"))
+  float RecentlyRenderedTolerance = 0.2f;
+
+  /** Returns the tick interval for an owner at the given location. */
+  float ComputeTickInterval(const UWorld *World, const AActor *Owner,
+                            const FVector &Location) const;
+};
+
+/**
+ * Per-component runtime state of the significance policy. Tracks world time
+ * between updates so a throttled component receives the full time elapsed
+ * since its previous update, whatever interval the engine ticked it at. The
+ * elapsed time is scaled by the owner's CustomTimeDilation, as DeltaTime is.
+ */
+struct SIMPLECOMP_API FSCSignificanceState {
+  /**
+   * Re-evaluates the component's tick interval and returns the time to
+   * simulate for this update. Returns DeltaTime unchanged when throttling is
+   * disabled.
+   */
+  float Update(UActorComponent &Component,
+               const FSCSignificanceSettings &Settings, float DeltaTime);
+
+  /**
+   * Variant of Update for components evaluated by a batching subsystem while
+   * their own tick is disabled. Leaves the component tick interval alone and
+   * returns 0 until the current interval has elapsed, after which it returns
+   * the time since the previous update.
+   */
+  float UpdateBatched(const UActorComponent &Component,
+                      const FSCSignificanceSettings &Settings,
+                      float DeltaTime);
+
+  /** Forgets the previous update time and re-applies the tick interval on
+   * the next update. Call when the component resumes after a period in which
+   * no time should be simulated. */
+  void Reset() {
+    LastUpdateTime = -1.0;
+    NextBatchedUpdateTime = -1.0;
+    TickInterval = -1.0f;
+  }
+
+private:
+  double LastUpdateTime = -1.0;
+  float TickInterval = 0.0f;
+  double NextBatchedUpdateTime = -1.0;
+};
@@ -34,6 +34,32 @@ enum class ESCRotationMode : uint8 {
   Constant UMETA(DisplayName = "Constant Rotation")
 };
 
+/**
+ * Defines which candidate a rotation component acquires automatically.
+ */
+UENUM(BlueprintType)
+enum class ESCAutoTargetSelection : uint8 {
+  /** The closest candidate. */
+  Nearest UMETA(DisplayName = "Nearest"),
+  /** The candidate closest to the center of the acquisition cone. */
+  MostAligned UMETA(DisplayName = "Most Aligned")
+};
+
+/**
+ * Defines how Constant rotation is evaluated.
+ */
+UENUM(BlueprintType)
+enum class ESCConstantRotationMethod : uint8 {
+  /** Adds RotationRate * DeltaTime every update. */
+  Accumulate UMETA(DisplayName = "Accumulate"),
+  /** Computes the rotation from world time, so the angle is exact at any
+     tick rate. */
+  Analytic UMETA(DisplayName = "Analytic"),
+  /** Writes the spin to custom primitive data once and lets the material
+     rotate the mesh. The component does not tick. */
+  CustomPrimitiveData UMETA(DisplayName = "Custom Primitive Data")
+};
+
 /**
  * Defines what transform property a curve track should drive.
  */
@@ -54,6 +80,46 @@ enum class ESCCurveTrackType : uint8 {
   CustomFloat
 };
 
+/**
+ * Defines which scene component a curve track drives.
+ */
+UENUM(BlueprintType)
+enum class ESCAnimTargetType : uint8 {
+  /** The component playing the sequence. */
+  Self UMETA(DisplayName = "Self"),
+  /** A scene component of the owning actor, found by name. */
+  Component UMETA(DisplayName = "Component"),
+  /** A scene component of the owning actor attached at the named socket. */
+  Socket UMETA(DisplayName = "Attached at Socket")
+};
+
+/**
+ * Defines the order in which a playlist plays its entries.
+ */
+UENUM(BlueprintType)
+enum class ESCAnimPlaylistOrder : uint8 {
+  /** Entries play in list order. */
+  Sequential UMETA(DisplayName = "Sequential"),
+  /** Each next entry is picked at random, weighted by its Weight. */
+  Random UMETA(DisplayName = "Random")
+};
+
+/**
+ * Defines how an animation sequence samples its curve tracks at runtime.
+ */
+UENUM(BlueprintType)
+enum class ESCAnimEvaluationMode : uint8 {
+  /** Curves are evaluated from their keys on every update. */
+  Exact UMETA(DisplayName = "Exact"),
+  /** Curves are baked into uniform-rate sample tables and interpolated
+     linearly. Tracks that exceed the error tolerance stay exact. */
+  Baked UMETA(DisplayName = "Baked Samples"),
+  /** Curves are reduced to the fewest linear keys within the error tolerance
+     and stored as 16-bit values. Cooking strips the source curves they
+     replace. Tracks that exceed the tolerance stay exact. */
+  Compressed UMETA(DisplayName = "Compressed Keys")
+};
+
 /**
  * Defines the space in which transformations are applied.
  */
@@ -2,8 +2,11 @@
 
 #pragma once
 
+#include "Logging/LogMacros.h"
 #include "Modules/ModuleManager.h"
 
+SIMPLECOMP_API DECLARE_LOG_CATEGORY_EXTERN(LogSimpleComp, Log, All);
+
 class FSimpleCompModule : public IModuleInterface
 {
 public:
@@ -28,6 +28,7 @@ public class SimpleComp : ModuleRules
 				"Core",
 				"CoreUObject",
 				"Engine",
+				"MovieScene",
 				// ... add other public dependencies that you statically link with here ...
 			}
 			);
@@ -36,6 +37,7 @@ public class SimpleComp : ModuleRules
 		PrivateDependencyModuleNames.AddRange(
 			new string[]
 			{
+				"PhysicsCore",
 				"Slate",
 				"SlateCore",
 				// ... add private dependencies that you statically link with here ...	
@@ -0,0 +1,81 @@
+#include "SCAnimTrackEditor.h"
+#include "Components/Animation/SCCurveAnimComponent.h"
+#include "Components/Animation/SCMovieSceneAnimTrack.h"
+#include "Framework/MultiBox/MultiBoxBuilder.h"
+#include "ISequencer.h"
+#include "ISequencerSection.h"
+#include "MovieScene.h"
+#include "MovieSceneSequence.h"
+#include "ScopedTransaction.h"
+
+#define LOCTEXT_NAMESPACE "FSCAnimTrackEditor"
+
+FSCAnimTrackEditor::FSCAnimTrackEditor(TSharedRef<ISequencer> InSequencer)
+    : FMovieSceneTrackEditor(InSequencer) {}
+
+TSharedRef<ISequencerTrackEditor>
+FSCAnimTrackEditor::CreateTrackEditor(TSharedRef<ISequencer> InSequencer) {
+  return MakeShared<FSCAnimTrackEditor>(InSequencer);
+}
+
+bool FSCAnimTrackEditor::SupportsType(
+    TSubclassOf<UMovieSceneTrack> Type) const {
+  return Type == USCMovieSceneAnimTrack::StaticClass();
+}
+
+void FSCAnimTrackEditor::BuildObjectBindingTrackMenu(
+    FMenuBuilder &MenuBuilder, const TArray<FGuid> &ObjectBindings,
+    const UClass *ObjectClass) {
+  if (!ObjectClass ||
+      !ObjectClass->IsChildOf(USCCurveAnimComponent::StaticClass())) {
+    return;
+  }
+
+  MenuBuilder.AddMenuEntry(
+      LOCTEXT("AddTrack", "Simple Animation"),
+      LOCTEXT("AddTrackTooltip",
+              "Adds a track that plays an SC Animation Sequence."),
+      FSlateIcon(),
+      FUIAction(FExecuteAction::CreateSP(this, &FSCAnimTrackEditor::AddTrack,
+                                         ObjectBindings)));
+}
+
+TSharedRef<ISequencerSection>
+FSCAnimTrackEditor::MakeSectionInterface(UMovieSceneSection &SectionObject,
+                                         UMovieSceneTrack &Track,
+                                         FGuid ObjectBinding) {
+  return MakeShared<FSequencerSection>(SectionObject);
+}
+
+void FSCAnimTrackEditor::AddTrack(TArray<FGuid> ObjectBindings) {
+  UMovieSceneSequence *Sequence = GetFocusedMovieSceneSequence();
+  UMovieScene *MovieScene = Sequence ? Sequence->GetMovieScene() : nullptr;
+  if (!MovieScene || MovieScene->IsReadOnly()) {
+    return;
+  }
+
+  const FScopedTransaction Transaction(
+      LOCTEXT("AddTrackTransaction", "Add Simple Animation Track"));
+  MovieScene->Modify();
+
+  const FFrameNumber StartFrame =
+      GetSequencer()->GetLocalTime().Time.FrameNumber;
+  for (const FGuid &Binding : ObjectBindings) {
+    USCMovieSceneAnimTrack *Track =
+        MovieScene->FindTrack<USCMovieSceneAnimTrack>(Binding);
+    if (!Track) {
+      Track = MovieScene->AddTrack<USCMovieSceneAnimTrack>(Binding);
+    }
+
+    UMovieSceneSection *Section = Track->CreateNewSection();
+    Section->SetRange(TRange<FFrameNumber>(
+        StartFrame, StartFrame + MovieScene->GetTickResolution().AsFrameNumber(
+                                     1.0)));
+    Track->AddSection(*Section);
+  }
+
+  GetSequencer()->NotifyMovieSceneDataChanged(
+      EMovieSceneDataChangeType::MovieSceneStructureItemAdded);
+}
+
+#undef LOCTEXT_NAMESPACE
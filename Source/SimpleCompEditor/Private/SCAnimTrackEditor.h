@@ -0,0 +1,27 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "MovieSceneTrackEditor.h"
+
+/**
+ * Sequencer editor for USCMovieSceneAnimTrack. Adds the track to bindings of
+ * USCCurveAnimComponent and its subclasses.
+ */
+class FSCAnimTrackEditor : public FMovieSceneTrackEditor {
+public:
+  explicit FSCAnimTrackEditor(TSharedRef<ISequencer> InSequencer);
+
+  static TSharedRef<ISequencerTrackEditor>
+  CreateTrackEditor(TSharedRef<ISequencer> InSequencer);
+
+  virtual bool SupportsType(TSubclassOf<UMovieSceneTrack> Type) const override;
+  virtual void BuildObjectBindingTrackMenu(FMenuBuilder &MenuBuilder,
+                                           const TArray<FGuid> &ObjectBindings,
+                                           const UClass *ObjectClass) override;
+  virtual TSharedRef<ISequencerSection>
+  MakeSectionInterface(UMovieSceneSection &SectionObject,
+                       UMovieSceneTrack &Track, FGuid ObjectBinding) override;
+
+private:
+  void AddTrack(TArray<FGuid> ObjectBindings);
+};
@@ -1,13 +1,22 @@
 #include "SimpleCompEditor.h"
+#include "ISequencerModule.h"
+#include "SCAnimTrackEditor.h"
 
 #define LOCTEXT_NAMESPACE "FSimpleCompEditorModule"
 
 void FSimpleCompEditorModule::StartupModule() {
-  // This code will execute after your module is loaded into memory
+  ISequencerModule &SequencerModule =
+      FModuleManager::LoadModuleChecked<ISequencerModule>("Sequencer");
+  AnimTrackEditorHandle =
+      SequencerModule.RegisterTrackEditor(FOnCreateTrackEditor::CreateStatic(
+          &FSCAnimTrackEditor::CreateTrackEditor));
 }
 
 void FSimpleCompEditorModule::ShutdownModule() {
-  // This function may be called during shutdown to clean up your module
+  if (ISequencerModule *SequencerModule =
+          FModuleManager::GetModulePtr<ISequencerModule>("Sequencer")) {
+    SequencerModule->UnRegisterTrackEditor(AnimTrackEditorHandle);
+  }
 }
 
 #undef LOCTEXT_NAMESPACE
@@ -1,4 +1,6 @@
 #include "UK2Node_PlaySCAnimation.h"
+#include "Algo/AnyOf.h"
+#include "AssetRegistry/IAssetRegistry.h"
 #include "BlueprintActionDatabaseRegistrar.h"
 #include "BlueprintNodeSpawner.h"
 #include "Components/Animation/SCAnimAsyncAction.h"
@@ -10,6 +12,7 @@
 #include "K2Node_CallFunction.h"
 #include "K2Node_CustomEvent.h"
 #include "K2Node_ExecutionSequence.h"
+#include "K2Node_IfThenElse.h"
 #include "K2Node_Self.h"
 #include "K2Node_SwitchName.h"
 #include "K2Node_TemporaryVariable.h"
@@ -36,11 +39,12 @@ const FName UK2Node_PlaySCAnimation::PN_Update(TEXT("Update"));
 const FName UK2Node_PlaySCAnimation::PN_Finished(TEXT("Finished"));
 const FName UK2Node_PlaySCAnimation::PN_Component(TEXT("Component"));
 const FName UK2Node_PlaySCAnimation::PN_Sequence(TEXT("Sequence"));
+const FName UK2Node_PlaySCAnimation::PN_SoftSequence(TEXT("SoftSequence"));
 const FName UK2Node_PlaySCAnimation::PN_Duration(TEXT("Duration"));
 const FName UK2Node_PlaySCAnimation::PN_CurrentTime(TEXT("CurrentTime"));
 const FName UK2Node_PlaySCAnimation::PN_NormalizedTime(TEXT("NormalizedTime"));
 
-UK2Node_PlaySCAnimation::UK2Node_PlaySCAnimation() { AnimSequence = nullptr; }
+UK2Node_PlaySCAnimation::UK2Node_PlaySCAnimation() {}
 
 void UK2Node_PlaySCAnimation::AllocateDefaultPins() {
   Super::AllocateDefaultPins();
@@ -66,12 +70,21 @@ void UK2Node_PlaySCAnimation::AllocateDefaultPins() {
   UEdGraphPin *SequencePin =
       CreatePin(EGPD_Input, UEdGraphSchema_K2::PC_Object,
                 USCAnimSequence::StaticClass(), PN_Sequence);
-  SequencePin->DefaultObject = AnimSequence;
   K2Schema->ConstructBasicPinTooltip(
       *SequencePin,
       NSLOCTEXT("K2Node", "SequenceTooltip", "Optional sequence override"),
       SequencePin->PinToolTip);
 
+  UEdGraphPin *SoftSequencePin =
+      CreatePin(EGPD_Input, UEdGraphSchema_K2::PC_SoftObject,
+                USCAnimSequence::StaticClass(), PN_SoftSequence);
+  SoftSequencePin->DefaultValue = AnimSequence.ToString();
+  K2Schema->ConstructBasicPinTooltip(
+      *SoftSequencePin,
+      NSLOCTEXT("K2Node", "SoftSequenceTooltip",
+                "Sequence streamed in and played when Sequence is not set"),
+      SoftSequencePin->PinToolTip);
+
   UEdGraphPin *DurationPin =
       CreatePin(EGPD_Input, UEdGraphSchema_K2::PC_Real, PN_Duration);
   K2Schema->ConstructBasicPinTooltip(
@@ -101,11 +114,28 @@ void UK2Node_PlaySCAnimation::AllocateDefaultPins() {
   CreateNotifyPins();
 }
 
-void UK2Node_PlaySCAnimation::CreateNotifyPins() {
-  if (!AnimSequence)
-    return;
+TArray<FName> UK2Node_PlaySCAnimation::GetNotifyNames() const {
+  if (AnimSequence.IsNull())
+    return TArray<FName>();
+
+  if (const USCAnimSequence *Loaded = AnimSequence.Get()) {
+    return Loaded->GetNotifyNames();
+  }
 
-  TArray<FName> NotifyNames = AnimSequence->GetNotifyNames();
+  const FAssetData AssetData =
+      IAssetRegistry::GetChecked().GetAssetByObjectPath(
+          AnimSequence.ToSoftObjectPath());
+  FString TagValue;
+  if (AssetData.GetTagValue(USCAnimSequence::NotifyNamesTag, TagValue)) {
+    return USCAnimSequence::ParseNotifyNamesTag(TagValue);
+  }
+
+  const USCAnimSequence *Sequence = AnimSequence.LoadSynchronous();
+  return Sequence ? Sequence->GetNotifyNames() : TArray<FName>();
+}
+
+void UK2Node_PlaySCAnimation::CreateNotifyPins() {
+  const TArray<FName> NotifyNames = GetNotifyNames();
   for (const FName &NotifyName : NotifyNames) {
     if (!NotifyName.IsNone()) {
       UEdGraphPin *NotifyPin =
@@ -134,30 +164,25 @@ void UK2Node_PlaySCAnimation::RemoveNotifyPins() {
 }
 
 void UK2Node_PlaySCAnimation::ReconstructNode() {
-  if (UEdGraphPin *SequencePin = FindPin(PN_Sequence)) {
-    if (SequencePin->DefaultObject) {
-      AnimSequence = Cast<USCAnimSequence>(SequencePin->DefaultObject);
-    } else if (SequencePin->LinkedTo.Num() == 0) {
-      AnimSequence = nullptr;
-    }
+  UEdGraphPin *SequencePin = FindPin(PN_Sequence);
+  UEdGraphPin *SoftSequencePin = FindPin(PN_SoftSequence);
+  if (SequencePin && SequencePin->DefaultObject) {
+    AnimSequence = Cast<USCAnimSequence>(SequencePin->DefaultObject);
+  } else if (SoftSequencePin && !SoftSequencePin->DefaultValue.IsEmpty()) {
+    AnimSequence = TSoftObjectPtr<USCAnimSequence>(
+        FSoftObjectPath(SoftSequencePin->DefaultValue));
+  } else if (SequencePin && SequencePin->LinkedTo.Num() == 0 &&
+             (!SoftSequencePin || SoftSequencePin->LinkedTo.Num() == 0)) {
+    AnimSequence.Reset();
   }
 
   Super::ReconstructNode();
 }
 
-void UK2Node_PlaySCAnimation::PreloadRequiredAssets() {
-  if (AnimSequence) {
-    PreloadObject(AnimSequence);
-    // Ensure pins are reconstructed after force-loading the asset
-    ReconstructNode();
-  }
-  Super::PreloadRequiredAssets();
-}
-
 void UK2Node_PlaySCAnimation::PinDefaultValueChanged(UEdGraphPin *Pin) {
   Super::PinDefaultValueChanged(Pin);
 
-  if (Pin && Pin->PinName == PN_Sequence) {
+  if (Pin && (Pin->PinName == PN_Sequence || Pin->PinName == PN_SoftSequence)) {
     ReconstructNode();
   }
 }
@@ -165,7 +190,7 @@ void UK2Node_PlaySCAnimation::PinDefaultValueChanged(UEdGraphPin *Pin) {
 void UK2Node_PlaySCAnimation::PinConnectionListChanged(UEdGraphPin *Pin) {
   Super::PinConnectionListChanged(Pin);
 
-  if (Pin && Pin->PinName == PN_Sequence) {
+  if (Pin && (Pin->PinName == PN_Sequence || Pin->PinName == PN_SoftSequence)) {
     ReconstructNode();
   }
 }
@@ -181,6 +206,9 @@ void UK2Node_PlaySCAnimation::PostEditChangeProperty(
 
   if (PropertyName ==
       GET_MEMBER_NAME_CHECKED(UK2Node_PlaySCAnimation, AnimSequence)) {
+    if (UEdGraphPin *SoftSequencePin = FindPin(PN_SoftSequence)) {
+      SoftSequencePin->DefaultValue = AnimSequence.ToString();
+    }
     ReconstructNode();
   }
 }
@@ -201,7 +229,8 @@ void UK2Node_PlaySCAnimation::ExpandNode(
     class FKismetCompilerContext &CompilerContext, UEdGraph *SourceGraph) {
   Super::ExpandNode(CompilerContext, SourceGraph);
 
-  const UEdGraphSchema_K2 *K2Schema = GetDefault<UEdGraphSchema_K2>();
+  UEnum *CommandEnum = StaticEnum<ESCAnimProxyCommand>();
+  UClass *ProxyClass = USCAnimAsyncAction::StaticClass();
 
   // Helper to copy links from the node's input pin to an internal node's pin
   auto CopyInput = [&](const FName &NodePinName, UEdGraphNode *DestNode,
@@ -222,34 +251,6 @@ void UK2Node_PlaySCAnimation::ExpandNode(
     }
   };
 
-  // Helper to move links from the node's output pin to an internal node's pin
-  auto MoveOutput = [&](const FName &NodePinName, UEdGraphNode *SourceNode,
-                        const FName &SourcePinName) {
-    UEdGraphPin *NodePin = FindPin(NodePinName);
-    UEdGraphPin *SourcePin =
-        SourceNode ? SourceNode->FindPin(SourcePinName) : nullptr;
-    if (NodePin && SourcePin) {
-      CompilerContext.MovePinLinksToIntermediate(*NodePin, *SourcePin);
-    }
-  };
-
-  struct FActionPath {
-    FName ExecPinName;
-    FName FuncName;
-    bool bIsControl;
-    bool bSetFromStart;
-    bool bValueFromStart;
-  };
-
-  const TArray<FActionPath> Paths = {
-      {PN_Play, TEXT("Play"), false, true, false},
-      {PN_PlayFromStart, TEXT("Play"), false, true, true},
-      {PN_Stop, TEXT("Stop"), true, false, false},
-      {PN_Pause, TEXT("Pause"), true, false, false},
-      {PN_Resume, TEXT("Resume"), true, false, false},
-      {PN_ReverseFromEnd, TEXT("ReverseFromEnd"), false, true, true},
-      {PN_ReverseFromCurrent, TEXT("ReverseFromCurrent"), false, false, false}};
-
   auto ConnectInternalOutputToUserOutput = [&](UEdGraphPin *InternalOut,
                                                const FName &NodeOutputName) {
     if (!InternalOut)
@@ -263,187 +264,178 @@ void UK2Node_PlaySCAnimation::ExpandNode(
     }
   };
 
-  for (const FActionPath &Path : Paths) {
-    UEdGraphPin *ExecInput = FindPin(Path.ExecPinName);
+  struct FCommandPin {
+    FName ExecPinName;
+    ESCAnimProxyCommand Command;
+  };
+
+  const FCommandPin CommandPins[] = {
+      {PN_Play, ESCAnimProxyCommand::Play},
+      {PN_PlayFromStart, ESCAnimProxyCommand::PlayFromStart},
+      {PN_Stop, ESCAnimProxyCommand::Stop},
+      {PN_Pause, ESCAnimProxyCommand::Pause},
+      {PN_Resume, ESCAnimProxyCommand::Resume},
+      {PN_ReverseFromEnd, ESCAnimProxyCommand::ReverseFromEnd},
+      {PN_ReverseFromCurrent, ESCAnimProxyCommand::ReverseFromCurrent}};
+
+  const bool bAnyExecLinked =
+      Algo::AnyOf(CommandPins, [this](const FCommandPin &CommandPin) {
+        const UEdGraphPin *Pin = FindPin(CommandPin.ExecPinName);
+        return Pin && Pin->LinkedTo.Num() > 0;
+      });
+  if (!bAnyExecLinked) {
+    BreakAllNodeLinks();
+    return;
+  }
+
+  // The proxy survives between executions of the owning graph, so every
+  // input pin of this node drives the same playback and output events.
+  UK2Node_TemporaryVariable *ProxyVar =
+      CompilerContext.SpawnIntermediateNode<UK2Node_TemporaryVariable>(
+          this, SourceGraph);
+  ProxyVar->VariableType.PinCategory = UEdGraphSchema_K2::PC_Object;
+  ProxyVar->VariableType.PinSubCategoryObject = ProxyClass;
+  ProxyVar->bIsPersistent = true;
+  ProxyVar->AllocateDefaultPins();
+
+  UK2Node_TemporaryVariable *CommandVar =
+      CompilerContext.SpawnIntermediateNode<UK2Node_TemporaryVariable>(
+          this, SourceGraph);
+  CommandVar->VariableType.PinCategory = UEdGraphSchema_K2::PC_Byte;
+  CommandVar->VariableType.PinSubCategoryObject = CommandEnum;
+  CommandVar->AllocateDefaultPins();
+
+  UK2Node_CallFunction *GetProxyNode =
+      CompilerContext.SpawnIntermediateNode<UK2Node_CallFunction>(this,
+                                                                  SourceGraph);
+  GetProxyNode->FunctionReference.SetExternalMember(
+      GET_FUNCTION_NAME_CHECKED(USCAnimAsyncAction, GetOrCreateProxy),
+      ProxyClass);
+  GetProxyNode->AllocateDefaultPins();
+  GetProxyNode->FindPin(TEXT("Existing"))
+      ->MakeLinkTo(ProxyVar->GetVariablePin());
+  CopyInput(PN_Component, GetProxyNode, TEXT("Component"));
+  CopyInput(PN_Sequence, GetProxyNode, TEXT("Sequence"));
+  CopyInput(PN_SoftSequence, GetProxyNode, TEXT("SoftSequence"));
+  CopyInput(PN_Duration, GetProxyNode, TEXT("Duration"));
+  CopyInput(PN_Loop, GetProxyNode, TEXT("bLoop"));
+
+  // Each input exec pin only records its command before joining the shared
+  // chain.
+  for (const FCommandPin &CommandPin : CommandPins) {
+    UEdGraphPin *ExecInput = FindPin(CommandPin.ExecPinName);
     if (!ExecInput || ExecInput->LinkedTo.Num() == 0) {
       continue;
     }
 
-    UK2Node_CallFunction *CreateProxyNode =
-        CompilerContext.SpawnIntermediateNode<UK2Node_CallFunction>(
+    UK2Node_AssignmentStatement *SetCommand =
+        CompilerContext.SpawnIntermediateNode<UK2Node_AssignmentStatement>(
             this, SourceGraph);
-    CreateProxyNode->FunctionReference.SetExternalMember(
-        GET_FUNCTION_NAME_CHECKED(USCAnimAsyncAction, CreateProxy),
-        USCAnimAsyncAction::StaticClass());
-    CreateProxyNode->AllocateDefaultPins();
-
-    CopyInput(PN_Component, CreateProxyNode, TEXT("Component"));
-    CopyInput(PN_Sequence, CreateProxyNode, TEXT("Sequence"));
-    CopyInput(PN_Duration, CreateProxyNode, TEXT("Duration"));
-    CopyInput(PN_Loop, CreateProxyNode, TEXT("bLoop"));
+    SetCommand->AllocateDefaultPins();
+    SetCommand->GetVariablePin()->MakeLinkTo(CommandVar->GetVariablePin());
+    SetCommand->PinConnectionListChanged(SetCommand->GetVariablePin());
+    SetCommand->GetValuePin()->DefaultValue = CommandEnum->GetNameStringByValue(
+        static_cast<int64>(CommandPin.Command));
 
     CompilerContext.MovePinLinksToIntermediate(*ExecInput,
-                                               *CreateProxyNode->GetExecPin());
-
-    UEdGraphPin *ProxyPin = CreateProxyNode->GetReturnValuePin();
-
-    UEdGraphNode *LastNode = CreateProxyNode;
-
-    if (!Path.bIsControl) {
-      auto SetupDelegate = [&](const FName &DelegateName,
-                               const FName &NodeOutName,
-                               const FName &ParamName = NAME_None,
-                               const FName &NodeParamName = NAME_None,
-                               const FName &ParamName2 = NAME_None,
-                               const FName &NodeParamName2 = NAME_None) {
-        UK2Node_AddDelegate *AddDel =
-            CompilerContext.SpawnIntermediateNode<UK2Node_AddDelegate>(
-                this, SourceGraph);
-        AddDel->SetFromProperty(
-            USCAnimAsyncAction::StaticClass()->FindPropertyByName(DelegateName),
-            false, USCAnimAsyncAction::StaticClass());
-        AddDel->AllocateDefaultPins();
-
-        if (UEdGraphPin *Self = AddDel->FindPin(UEdGraphSchema_K2::PN_Self)) {
-          Self->MakeLinkTo(ProxyPin);
-        }
-
-        UK2Node_CustomEvent *Evt =
-            CompilerContext.SpawnIntermediateNode<UK2Node_CustomEvent>(
-                this, SourceGraph);
-        Evt->CustomFunctionName = *FString::Printf(
-            TEXT("%s_%s_%s"), *GetName(), *DelegateName.ToString(),
-            *FGuid::NewGuid().ToString());
-
-        if (FMulticastDelegateProperty *Prop =
-                CastField<FMulticastDelegateProperty>(
-                    USCAnimAsyncAction::StaticClass()->FindPropertyByName(
-                        DelegateName))) {
-          Evt->SetDelegateSignature(Prop->SignatureFunction);
-        }
-        Evt->AllocateDefaultPins();
-
-        if (UEdGraphPin *DelPin = AddDel->GetDelegatePin()) {
-          DelPin->MakeLinkTo(
-              Evt->FindPin(UK2Node_CustomEvent::DelegateOutputName));
-        }
-
-        LastNode->FindPin(UEdGraphSchema_K2::PN_Then)
-            ->MakeLinkTo(AddDel->GetExecPin());
-        LastNode = AddDel;
-
-        ConnectInternalOutputToUserOutput(
-            Evt->FindPin(UEdGraphSchema_K2::PN_Then), NodeOutName);
-
-        if (!ParamName.IsNone() && !NodeParamName.IsNone()) {
-          ConnectInternalOutputToUserOutput(Evt->FindPin(ParamName),
-                                            NodeParamName);
-        }
-        if (!ParamName2.IsNone() && !NodeParamName2.IsNone()) {
-          ConnectInternalOutputToUserOutput(Evt->FindPin(ParamName2),
-                                            NodeParamName2);
-        }
-
-        return Evt;
-      };
-
-      SetupDelegate(TEXT("Update"), PN_Update, TEXT("CurrentTime"),
-                    PN_CurrentTime, TEXT("NormalizedTime"), PN_NormalizedTime);
-      SetupDelegate(TEXT("Finished"), PN_Finished);
-
-      UK2Node_AddDelegate *AddDelNotify =
-          CompilerContext.SpawnIntermediateNode<UK2Node_AddDelegate>(
-              this, SourceGraph);
-      AddDelNotify->SetFromProperty(
-          USCAnimAsyncAction::StaticClass()->FindPropertyByName(
-              TEXT("OnNotify")),
-          false, USCAnimAsyncAction::StaticClass());
-      AddDelNotify->AllocateDefaultPins();
-      if (UEdGraphPin *Self =
-              AddDelNotify->FindPin(UEdGraphSchema_K2::PN_Self)) {
-        Self->MakeLinkTo(ProxyPin);
-      }
-
-      UK2Node_CustomEvent *EvtNotify =
-          CompilerContext.SpawnIntermediateNode<UK2Node_CustomEvent>(
-              this, SourceGraph);
-      EvtNotify->CustomFunctionName = *FString::Printf(
-          TEXT("%s_OnNotify_%s"), *GetName(), *FGuid::NewGuid().ToString());
-      if (FMulticastDelegateProperty *Prop =
-              CastField<FMulticastDelegateProperty>(
-                  USCAnimAsyncAction::StaticClass()->FindPropertyByName(
-                      TEXT("OnNotify")))) {
-        EvtNotify->SetDelegateSignature(Prop->SignatureFunction);
-      }
-      EvtNotify->AllocateDefaultPins();
-      if (UEdGraphPin *DelPin = AddDelNotify->GetDelegatePin()) {
-        DelPin->MakeLinkTo(
-            EvtNotify->FindPin(UK2Node_CustomEvent::DelegateOutputName));
-      }
-
-      LastNode->FindPin(UEdGraphSchema_K2::PN_Then)
-          ->MakeLinkTo(AddDelNotify->GetExecPin());
-      LastNode = AddDelNotify;
-
-      if (AnimSequence) {
-        UK2Node_SwitchName *Switch =
-            CompilerContext.SpawnIntermediateNode<UK2Node_SwitchName>(
-                this, SourceGraph);
-        Switch->AllocateDefaultPins();
-        EvtNotify->FindPin(UEdGraphSchema_K2::PN_Then)
-            ->MakeLinkTo(Switch->GetExecPin());
-        if (UEdGraphPin *NamePin = EvtNotify->FindPin(TEXT("NotifyName"))) {
-          NamePin->MakeLinkTo(Switch->GetSelectionPin());
-        }
-
-        for (const FSCAnimNotify &Notify : AnimSequence->Notifies) {
-          Switch->AddPinToSwitchNode();
-          UEdGraphPin *SwPin = Switch->Pins.Last();
-          // Ensure PinName matches the NotifyName for the Switch to route
-          // correctly
-          SwPin->PinName = Notify.NotifyName;
-          SwPin->PinFriendlyName = FText::FromName(Notify.NotifyName);
-
-          ConnectInternalOutputToUserOutput(SwPin, Notify.NotifyName);
-        }
-      }
-
-      UK2Node_CallFunction *ActivateNode =
-          CompilerContext.SpawnIntermediateNode<UK2Node_CallFunction>(
-              this, SourceGraph);
-      ActivateNode->FunctionReference.SetExternalMember(
-          GET_FUNCTION_NAME_CHECKED(UBlueprintAsyncActionBase, Activate),
-          UBlueprintAsyncActionBase::StaticClass());
-      ActivateNode->AllocateDefaultPins();
-      if (UEdGraphPin *Self =
-              ActivateNode->FindPin(UEdGraphSchema_K2::PN_Self)) {
-        Self->MakeLinkTo(ProxyPin);
-      }
-      LastNode->FindPin(UEdGraphSchema_K2::PN_Then)
-          ->MakeLinkTo(ActivateNode->GetExecPin());
-      LastNode = ActivateNode;
-    }
+                                               *SetCommand->GetExecPin());
+    SetCommand->GetThenPin()->MakeLinkTo(GetProxyNode->GetExecPin());
+  }
 
-    UK2Node_CallFunction *CallFuncNode =
-        CompilerContext.SpawnIntermediateNode<UK2Node_CallFunction>(
+  UK2Node_AssignmentStatement *SetProxy =
+      CompilerContext.SpawnIntermediateNode<UK2Node_AssignmentStatement>(
+          this, SourceGraph);
+  SetProxy->AllocateDefaultPins();
+  SetProxy->GetVariablePin()->MakeLinkTo(ProxyVar->GetVariablePin());
+  SetProxy->PinConnectionListChanged(SetProxy->GetVariablePin());
+  SetProxy->GetValuePin()->MakeLinkTo(GetProxyNode->GetReturnValuePin());
+  GetProxyNode->GetThenPin()->MakeLinkTo(SetProxy->GetExecPin());
+
+  UK2Node_IfThenElse *IfCreated =
+      CompilerContext.SpawnIntermediateNode<UK2Node_IfThenElse>(this,
+                                                                SourceGraph);
+  IfCreated->AllocateDefaultPins();
+  IfCreated->GetConditionPin()->MakeLinkTo(
+      GetProxyNode->FindPin(TEXT("bCreated")));
+  SetProxy->GetThenPin()->MakeLinkTo(IfCreated->GetExecPin());
+
+  UK2Node_CallFunction *RunNode =
+      CompilerContext.SpawnIntermediateNode<UK2Node_CallFunction>(this,
+                                                                  SourceGraph);
+  RunNode->FunctionReference.SetExternalMember(
+      GET_FUNCTION_NAME_CHECKED(USCAnimAsyncAction, RunCommand), ProxyClass);
+  RunNode->AllocateDefaultPins();
+  RunNode->FindPin(UEdGraphSchema_K2::PN_Self)
+      ->MakeLinkTo(ProxyVar->GetVariablePin());
+  RunNode->FindPin(TEXT("Command"))->MakeLinkTo(CommandVar->GetVariablePin());
+  IfCreated->GetElsePin()->MakeLinkTo(RunNode->GetExecPin());
+  ConnectInternalOutputToUserOutput(RunNode->GetThenPin(), PN_Then);
+
+  // Output events are bound once, when the proxy is created.
+  UEdGraphPin *LastThen = IfCreated->GetThenPin();
+  auto BindEvent = [&](const FName &DelegateName) {
+    FMulticastDelegateProperty *Prop = CastField<FMulticastDelegateProperty>(
+        ProxyClass->FindPropertyByName(DelegateName));
+
+    UK2Node_AddDelegate *AddDel =
+        CompilerContext.SpawnIntermediateNode<UK2Node_AddDelegate>(
             this, SourceGraph);
-    CallFuncNode->FunctionReference.SetExternalMember(
-        Path.FuncName, USCAnimAsyncAction::StaticClass());
-    CallFuncNode->AllocateDefaultPins();
-    if (UEdGraphPin *Self = CallFuncNode->FindPin(UEdGraphSchema_K2::PN_Self)) {
-      Self->MakeLinkTo(ProxyPin);
-    }
+    AddDel->SetFromProperty(Prop, false, ProxyClass);
+    AddDel->AllocateDefaultPins();
+    AddDel->FindPin(UEdGraphSchema_K2::PN_Self)
+        ->MakeLinkTo(ProxyVar->GetVariablePin());
 
-    if (Path.bSetFromStart) {
-      if (UEdGraphPin *Pin = CallFuncNode->FindPin(TEXT("bFromStart"))) {
-        Pin->DefaultValue = Path.bValueFromStart ? TEXT("true") : TEXT("false");
-      }
+    UK2Node_CustomEvent *Evt =
+        CompilerContext.SpawnIntermediateNode<UK2Node_CustomEvent>(
+            this, SourceGraph);
+    Evt->CustomFunctionName =
+        *FString::Printf(TEXT("%s_%s_%s"), *GetName(), *DelegateName.ToString(),
+                         *FGuid::NewGuid().ToString());
+    if (Prop) {
+      Evt->SetDelegateSignature(Prop->SignatureFunction);
     }
+    Evt->AllocateDefaultPins();
 
-    LastNode->FindPin(UEdGraphSchema_K2::PN_Then)
-        ->MakeLinkTo(CallFuncNode->GetExecPin());
+    AddDel->GetDelegatePin()->MakeLinkTo(
+        Evt->FindPin(UK2Node_CustomEvent::DelegateOutputName));
+    LastThen->MakeLinkTo(AddDel->GetExecPin());
+    LastThen = AddDel->GetThenPin();
+    return Evt;
+  };
 
-    ConnectInternalOutputToUserOutput(CallFuncNode->GetThenPin(), PN_Then);
+  UK2Node_CustomEvent *UpdateEvt = BindEvent(TEXT("Update"));
+  ConnectInternalOutputToUserOutput(
+      UpdateEvt->FindPin(UEdGraphSchema_K2::PN_Then), PN_Update);
+  ConnectInternalOutputToUserOutput(UpdateEvt->FindPin(TEXT("CurrentTime")),
+                                    PN_CurrentTime);
+  ConnectInternalOutputToUserOutput(UpdateEvt->FindPin(TEXT("NormalizedTime")),
+                                    PN_NormalizedTime);
+
+  UK2Node_CustomEvent *FinishedEvt = BindEvent(TEXT("Finished"));
+  ConnectInternalOutputToUserOutput(
+      FinishedEvt->FindPin(UEdGraphSchema_K2::PN_Then), PN_Finished);
+
+  UK2Node_CustomEvent *NotifyEvt = BindEvent(TEXT("OnNotify"));
+  LastThen->MakeLinkTo(RunNode->GetExecPin());
+
+  // Unnamed notifies have no output pin, as in CreateNotifyPins.
+  TArray<FName> NotifyNames = GetNotifyNames();
+  NotifyNames.RemoveAll([](const FName &Name) { return Name.IsNone(); });
+  if (NotifyNames.Num() > 0) {
+    UK2Node_SwitchName *Switch =
+        CompilerContext.SpawnIntermediateNode<UK2Node_SwitchName>(this,
+                                                                  SourceGraph);
+    Switch->PinNames = NotifyNames;
+    Switch->AllocateDefaultPins();
+    NotifyEvt->FindPin(UEdGraphSchema_K2::PN_Then)
+        ->MakeLinkTo(Switch->GetExecPin());
+    Switch->GetSelectionPin()->MakeLinkTo(
+        NotifyEvt->FindPin(TEXT("NotifyName")));
+
+    for (const FName &NotifyName : NotifyNames) {
+      ConnectInternalOutputToUserOutput(Switch->FindPin(NotifyName),
+                                        NotifyName);
+    }
   }
 
   BreakAllNodeLinks();
@@ -7,4 +7,7 @@ class FSimpleCompEditorModule : public IModuleInterface {
 public:
   virtual void StartupModule() override;
   virtual void ShutdownModule() override;
+
+private:
+  FDelegateHandle AnimTrackEditorHandle;
 };
@@ -31,7 +31,6 @@ public:
   virtual void GetMenuActions(
       FBlueprintActionDatabaseRegistrar &ActionRegistrar) const override;
   virtual FText GetMenuCategory() const override;
-  virtual void PreloadRequiredAssets() override;
   virtual void ExpandNode(class FKismetCompilerContext &CompilerContext,
                           UEdGraph *SourceGraph) override;
   virtual void ReconstructNode() override;
@@ -44,9 +43,10 @@ public:
   // End of UK2Node interface
 
   /** The animation sequence asset to use for generating dynamic notification
-   * pins. */
+   * pins. It is passed to the component as a soft reference, so the compiled
+   * Blueprint does not load it. */
   UPROPERTY(EditAnywhere, Category = "SimpleComp|Animation")
-  TObjectPtr<USCAnimSequence> AnimSequence;
+  TSoftObjectPtr<USCAnimSequence> AnimSequence;
 
 private:
   static const FName PN_Play;
@@ -60,6 +60,7 @@ private:
   // Input Data Pins
   static const FName PN_Component;
   static const FName PN_Sequence;
+  static const FName PN_SoftSequence;
   static const FName PN_Duration;
   static const FName PN_Loop;
 
@@ -70,6 +71,10 @@ private:
   static const FName PN_CurrentTime;
   static const FName PN_NormalizedTime;
 
+  /** Returns the sequence's notify names, read from the asset registry unless
+   * the sequence is already loaded. Sequences saved before the registry tag
+   * existed are loaded instead. */
+  TArray<FName> GetNotifyNames() const;
   void CreateNotifyPins();
   void RemoveNotifyPins();
 };
@@ -14,9 +14,12 @@ public class SimpleCompEditor : ModuleRules
 		});
 
 		PrivateDependencyModuleNames.AddRange(new string[] {
+			"AssetRegistry",
 			"BlueprintGraph",
 			"UnrealEd",
 			"KismetCompiler",
+			"MovieScene",
+			"Sequencer",
 			"Slate",
 			"SlateCore"
 		});